@@ -0,0 +1,80 @@
+#!/usr/bin/env bash
+# Runs a headless skater load test: one dedicated server plus N -nullrhi clients on this machine.
+#
+# Usage: run_load_test.sh <PackagedBuildDir> [options]
+#   -c, --clients N        Number of simulated clients (default 8)
+#   -d, --duration SEC     Test duration in seconds (default 120)
+#   -a, --density N        Artifacts per 10m x 10m area (default: config)
+#   -i, --input FILE       Recorded input file replayed by every client (default: scripted input)
+#   -p, --port PORT        Server port (default 7777)
+#   -o, --output DIR       Report directory (default ./LoadTestResults)
+#
+# <PackagedBuildDir> must contain LinuxServer/ and Linux/ builds of the project. No GPU is required.
+
+set -euo pipefail
+
+usage() { sed -n '2,12p' "$0" | sed 's/^# \{0,1\}//'; exit 1; }
+
+[[ $# -ge 1 ]] || usage
+BUILD_DIR="$1"; shift
+
+CLIENTS=8
+DURATION=120
+DENSITY=""
+INPUT=""
+PORT=7777
+OUTPUT="$(pwd)/LoadTestResults"
+
+while [[ $# -gt 0 ]]; do
+	case "$1" in
+		-c|--clients)  CLIENTS="$2"; shift 2 ;;
+		-d|--duration) DURATION="$2"; shift 2 ;;
+		-a|--density)  DENSITY="$2"; shift 2 ;;
+		-i|--input)    INPUT="$(realpath "$2")"; shift 2 ;;
+		-p|--port)     PORT="$2"; shift 2 ;;
+		-o|--output)   OUTPUT="$2"; shift 2 ;;
+		*) usage ;;
+	esac
+done
+
+SERVER_BIN="$BUILD_DIR/LinuxServer/Anderson_Task/Binaries/Linux/Anderson_TaskServer"
+CLIENT_BIN="$BUILD_DIR/Linux/Anderson_Task/Binaries/Linux/Anderson_Task"
+
+for BIN in "$SERVER_BIN" "$CLIENT_BIN"; do
+	[[ -x "$BIN" ]] || { echo "Missing executable: $BIN" >&2; exit 1; }
+done
+
+mkdir -p "$OUTPUT"
+STAMP="$(date +%Y%m%d_%H%M%S)"
+REPORT="$OUTPUT/LoadTest_${CLIENTS}c_${STAMP}.csv"
+
+SERVER_ARGS=(-log -unattended -SkaterLoadTest -Port="$PORT" -LoadTestDuration="$DURATION"
+	-LoadTestReport="$REPORT")
+[[ -n "$DENSITY" ]] && SERVER_ARGS+=(-LoadTestDensity="$DENSITY")
+
+echo "Starting server on port $PORT"
+"$SERVER_BIN" "${SERVER_ARGS[@]}" > "$OUTPUT/server_${STAMP}.log" 2>&1 &
+SERVER_PID=$!
+
+CLIENT_PIDS=()
+cleanup() {
+	kill "${CLIENT_PIDS[@]}" "$SERVER_PID" 2>/dev/null || true
+}
+trap cleanup EXIT
+
+# Give the server time to load the map before clients connect
+sleep 10
+
+for ((i = 0; i < CLIENTS; i++)); do
+	CLIENT_ARGS=(127.0.0.1:"$PORT" -nullrhi -nosound -unattended -log -SkaterLoadTest
+		-LoadTestSeed="$i" -LoadTestDuration="$DURATION")
+	[[ -n "$INPUT" ]] && CLIENT_ARGS+=(-LoadTestInput="$INPUT")
+
+	"$CLIENT_BIN" "${CLIENT_ARGS[@]}" > "$OUTPUT/client_${i}_${STAMP}.log" 2>&1 &
+	CLIENT_PIDS+=($!)
+done
+
+echo "Running $CLIENTS clients for ${DURATION}s"
+wait "$SERVER_PID" || true
+
+echo "Report: $REPORT"
@@ -11,12 +11,21 @@ public class Anderson_Task : ModuleRules
 			"Core", 
 			"CoreUObject", 
 			"Engine",
+			"AIModule",
 			"InputCore", 
 			"EnhancedInput",
 			"Niagara",
 			"UMG",         
 			"Slate",
-			"SlateCore"
+			"SlateCore",
+			"Json",
+			"NetCore",
+			"NavigationSystem",
+			"ReplicationGraph",
+			"SignificanceManager",
+			"TraceLog",
+			"ImageWrapper",
+			"AssetRegistry"
 		});
 	}
 }
@@ -0,0 +1,251 @@
+#include "Analytics/CollectionAnalyticsWorker.h"
+
+#include "HAL/Event.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY(LogCollectionAnalytics);
+
+FArchive& operator<<(FArchive& Ar, FSkaterCollectionEvent& Event)
+{
+	Ar << Event.CollectorId;
+	Ar << Event.ArtifactDataId;
+	Ar << Event.Location;
+	Ar << Event.Time;
+	Ar << Event.Points;
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FSkaterMovementSample& Sample)
+{
+	Ar << Sample.SkaterId;
+	Ar << Sample.Location;
+	Ar << Sample.Time;
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FSkaterArtifactPlacement& Placement)
+{
+	Ar << Placement.ArtifactDataId;
+	Ar << Placement.Location;
+	Ar << Placement.Time;
+	return Ar;
+}
+
+FCollectionAnalyticsWorker::FCollectionAnalyticsWorker(const FCollectionAnalyticsSettings& InSettings)
+	: Settings(InSettings)
+{
+	Settings.CellSize = FMath::Max(Settings.CellSize, 1.f);
+	Settings.MaxFiles = FMath::Max(Settings.MaxFiles, 1);
+	Aggregates.CellSize = Settings.CellSize;
+}
+
+FCollectionAnalyticsWorker::~FCollectionAnalyticsWorker()
+{
+	Shutdown();
+}
+
+bool FCollectionAnalyticsWorker::Start()
+{
+	if (Thread || !FPlatformProcess::SupportsMultithreading())
+	{
+		return Thread != nullptr;
+	}
+
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool();
+	Thread = FRunnableThread::Create(this, TEXT("SkaterCollectionAnalytics"), 0, TPri_BelowNormal);
+
+	return Thread != nullptr;
+}
+
+void FCollectionAnalyticsWorker::Shutdown()
+{
+	if (!Thread)
+	{
+		return;
+	}
+
+	Stop();
+	Thread->WaitForCompletion();
+
+	delete Thread;
+	Thread = nullptr;
+
+	FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	WakeEvent = nullptr;
+}
+
+void FCollectionAnalyticsWorker::Stop()
+{
+	bStopping = true;
+
+	if (WakeEvent)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+uint32 FCollectionAnalyticsWorker::Run()
+{
+	while (!bStopping)
+	{
+		WakeEvent->Wait(Settings.DrainIntervalMs);
+		Drain();
+	}
+
+	// Events queued before Stop are still written
+	Drain();
+
+	if (LogWriter)
+	{
+		LogWriter->Close();
+		LogWriter.Reset();
+	}
+
+	return 0;
+}
+
+void FCollectionAnalyticsWorker::Drain()
+{
+	CollectionBatch.Reset();
+	SampleBatch.Reset();
+	PlacementBatch.Reset();
+
+	FSkaterCollectionEvent Event;
+	while (Collections.Dequeue(Event))
+	{
+		CollectionBatch.Add(Event);
+	}
+
+	FSkaterMovementSample Sample;
+	while (Samples.Dequeue(Sample))
+	{
+		SampleBatch.Add(Sample);
+	}
+
+	FSkaterArtifactPlacement Placement;
+	while (Placements.Dequeue(Placement))
+	{
+		PlacementBatch.Add(Placement);
+	}
+
+	if (CollectionBatch.IsEmpty() && SampleBatch.IsEmpty() && PlacementBatch.IsEmpty())
+	{
+		return;
+	}
+
+	{
+		FScopeLock Lock(&AggregateLock);
+
+		for (const FSkaterCollectionEvent& Drained : CollectionBatch)
+		{
+			++Aggregates.CellCounts.FindOrAdd(GetCell(Drained.Location));
+
+			if (Aggregates.TotalEvents == 0)
+			{
+				Aggregates.FirstTime = Drained.Time;
+			}
+
+			++Aggregates.TotalEvents;
+			Aggregates.TotalPoints += Drained.Points;
+			Aggregates.LastTime = FMath::Max(Aggregates.LastTime, Drained.Time);
+		}
+
+		for (const FSkaterMovementSample& Drained : SampleBatch)
+		{
+			++Aggregates.CellSamples.FindOrAdd(GetCell(Drained.Location));
+		}
+
+		for (const FSkaterArtifactPlacement& Drained : PlacementBatch)
+		{
+			++Aggregates.CellPlacements.FindOrAdd(GetCell(Drained.Location));
+		}
+	}
+
+	if (!LogWriter || LogWriter->Tell() >= Settings.MaxFileBytes)
+	{
+		RollLogFile();
+	}
+
+	if (LogWriter)
+	{
+		WriteBlock(ESkaterAnalyticsRecord::Collection, CollectionBatch);
+		WriteBlock(ESkaterAnalyticsRecord::MovementSample, SampleBatch);
+		WriteBlock(ESkaterAnalyticsRecord::Placement, PlacementBatch);
+
+		LogWriter->Flush();
+	}
+}
+
+FIntPoint FCollectionAnalyticsWorker::GetCell(const FVector3f& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / Settings.CellSize),
+		FMath::FloorToInt32(Location.Y / Settings.CellSize));
+}
+
+template <typename RecordType>
+void FCollectionAnalyticsWorker::WriteBlock(ESkaterAnalyticsRecord Type, TArray<RecordType>& Records)
+{
+	if (Records.IsEmpty())
+	{
+		return;
+	}
+
+	uint8 BlockType = static_cast<uint8>(Type);
+	uint32 Count = Records.Num();
+
+	*LogWriter << BlockType;
+	*LogWriter << Count;
+
+	for (RecordType& Record : Records)
+	{
+		*LogWriter << Record;
+	}
+}
+
+void FCollectionAnalyticsWorker::RollLogFile()
+{
+	if (LogWriter)
+	{
+		LogWriter->Close();
+		LogWriter.Reset();
+	}
+
+	++LogIndex;
+
+	if (LogIndex >= Settings.MaxFiles)
+	{
+		IFileManager::Get().Delete(*GetLogPath(LogIndex - Settings.MaxFiles), false, false, true);
+	}
+
+	const FString Path = GetLogPath(LogIndex);
+	LogWriter.Reset(IFileManager::Get().CreateFileWriter(*Path));
+	if (!LogWriter)
+	{
+		UE_LOG(LogCollectionAnalytics, Error, TEXT("Failed to open analytics log %s"), *Path);
+		return;
+	}
+
+	uint32 FileMagic = Magic;
+	uint16 FileVersion = Version;
+	float CellSize = Settings.CellSize;
+	float SampleInterval = Settings.SampleInterval;
+
+	*LogWriter << FileMagic;
+	*LogWriter << FileVersion;
+	*LogWriter << CellSize;
+	*LogWriter << SampleInterval;
+}
+
+FString FCollectionAnalyticsWorker::GetLogPath(int32 Index) const
+{
+	return Settings.LogDirectory / FString::Printf(TEXT("%s_%03d.bin"), *Settings.LogPrefix, Index);
+}
+
+void FCollectionAnalyticsWorker::GetSnapshot(FCollectionAnalyticsSnapshot& OutSnapshot) const
+{
+	FScopeLock Lock(&AggregateLock);
+	OutSnapshot = Aggregates;
+}
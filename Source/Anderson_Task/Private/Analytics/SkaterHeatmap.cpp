@@ -0,0 +1,408 @@
+#include "Analytics/SkaterHeatmap.h"
+
+#include "Analytics/CollectionAnalyticsWorker.h"
+#include "HAL/FileManager.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "Misc/FileHelper.h"
+#include "Modules/ModuleManager.h"
+
+DEFINE_LOG_CATEGORY(LogSkaterHeatmap);
+
+namespace SkaterHeatmap
+{
+	// Serialized record sizes, used to skip truncated blocks
+	constexpr int64 CollectionSize = 28;
+	constexpr int64 SampleSize = 20;
+	constexpr int64 PlacementSize = 20;
+
+	void AddCollection(FSkaterAnalyticsStreams& Streams, const FSkaterCollectionEvent& Event)
+	{
+		Streams.CollectionX.Add(Event.Location.X);
+		Streams.CollectionY.Add(Event.Location.Y);
+		Streams.CollectionZ.Add(Event.Location.Z);
+		Streams.CollectionDataIds.Add(Event.ArtifactDataId);
+		Streams.CollectionPoints.Add(Event.Points);
+	}
+
+	/**
+	 * Rounds a location to the key shared by an artifact's placement and collection records.
+	 */
+	FIntVector GetLocationKey(float X, float Y, float Z)
+	{
+		return FIntVector(FMath::RoundToInt32(X), FMath::RoundToInt32(Y), FMath::RoundToInt32(Z));
+	}
+
+	void UpdateBounds(const TArray<float>& X, const TArray<float>& Y, FVector2f& Min, FVector2f& Max)
+	{
+		for (int32 i = 0; i < X.Num(); ++i)
+		{
+			Min.X = FMath::Min(Min.X, X[i]);
+			Min.Y = FMath::Min(Min.Y, Y[i]);
+			Max.X = FMath::Max(Max.X, X[i]);
+			Max.Y = FMath::Max(Max.Y, Y[i]);
+		}
+	}
+
+	bool SaveLines(const TArray<FString>& Lines, const FString& Path)
+	{
+		return FFileHelper::SaveStringArrayToFile(Lines, *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	}
+}
+
+bool FSkaterAnalyticsStreams::LoadLogFile(const FString& Path)
+{
+	using namespace SkaterHeatmap;
+
+	const TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Path));
+	if (!Reader)
+	{
+		UE_LOG(LogSkaterHeatmap, Error, TEXT("Failed to open %s"), *Path);
+		return false;
+	}
+
+	uint32 FileMagic = 0;
+	uint16 FileVersion = 0;
+	float FileCellSize = 0.f;
+	*Reader << FileMagic;
+	*Reader << FileVersion;
+	*Reader << FileCellSize;
+
+	if (Reader->IsError() || FileMagic != FCollectionAnalyticsWorker::Magic ||
+		FileVersion == 0 || FileVersion > FCollectionAnalyticsWorker::Version)
+	{
+		UE_LOG(LogSkaterHeatmap, Error, TEXT("%s is not a supported analytics log"), *Path);
+		return false;
+	}
+
+	float FileSampleInterval = 0.f;
+	if (FileVersion >= 2)
+	{
+		*Reader << FileSampleInterval;
+	}
+
+	if (LogCellSize <= 0.f)
+	{
+		LogCellSize = FileCellSize;
+	}
+
+	if (SampleInterval <= 0.f)
+	{
+		SampleInterval = FileSampleInterval;
+	}
+	else if (FileSampleInterval > 0.f && !FMath::IsNearlyEqual(FileSampleInterval, SampleInterval))
+	{
+		UE_LOG(LogSkaterHeatmap, Warning, TEXT("%s samples every %.2fs, dwell time assumes %.2fs"), *Path,
+			FileSampleInterval, SampleInterval);
+	}
+
+	const int64 FileSize = Reader->TotalSize();
+
+	// Version 1 holds collections only, without blocks
+	if (FileVersion == 1)
+	{
+		FSkaterCollectionEvent Event;
+		while (FileSize - Reader->Tell() >= CollectionSize)
+		{
+			*Reader << Event;
+			AddCollection(*this, Event);
+		}
+
+		return true;
+	}
+
+	while (FileSize - Reader->Tell() >= 5)
+	{
+		uint8 BlockType = 0;
+		uint32 Count = 0;
+		*Reader << BlockType;
+		*Reader << Count;
+
+		const int64 Remaining = FileSize - Reader->Tell();
+
+		switch (static_cast<ESkaterAnalyticsRecord>(BlockType))
+		{
+		case ESkaterAnalyticsRecord::Collection:
+			if (Remaining < Count * CollectionSize)
+			{
+				return true;
+			}
+
+			for (uint32 i = 0; i < Count; ++i)
+			{
+				FSkaterCollectionEvent Event;
+				*Reader << Event;
+				AddCollection(*this, Event);
+			}
+			break;
+
+		case ESkaterAnalyticsRecord::MovementSample:
+			if (Remaining < Count * SampleSize)
+			{
+				return true;
+			}
+
+			for (uint32 i = 0; i < Count; ++i)
+			{
+				FSkaterMovementSample Sample;
+				*Reader << Sample;
+				SampleX.Add(Sample.Location.X);
+				SampleY.Add(Sample.Location.Y);
+				SampleSkaterIds.Add(Sample.SkaterId);
+			}
+			break;
+
+		case ESkaterAnalyticsRecord::Placement:
+			if (Remaining < Count * PlacementSize)
+			{
+				return true;
+			}
+
+			for (uint32 i = 0; i < Count; ++i)
+			{
+				FSkaterArtifactPlacement Placement;
+				*Reader << Placement;
+				PlacementX.Add(Placement.Location.X);
+				PlacementY.Add(Placement.Location.Y);
+				PlacementZ.Add(Placement.Location.Z);
+				PlacementDataIds.Add(Placement.ArtifactDataId);
+			}
+			break;
+
+		default:
+			UE_LOG(LogSkaterHeatmap, Warning, TEXT("Unknown block type %d in %s, skipping the rest of the file"),
+				BlockType, *Path);
+			return true;
+		}
+	}
+
+	return true;
+}
+
+void FSkaterHeatmap::Build(const FSkaterAnalyticsStreams& Streams, float InCellSize)
+{
+	using namespace SkaterHeatmap;
+
+	FVector2f Min(TNumericLimits<float>::Max());
+	FVector2f Max(TNumericLimits<float>::Lowest());
+	UpdateBounds(Streams.CollectionX, Streams.CollectionY, Min, Max);
+	UpdateBounds(Streams.SampleX, Streams.SampleY, Min, Max);
+	UpdateBounds(Streams.PlacementX, Streams.PlacementY, Min, Max);
+
+	if (Min.X > Max.X)
+	{
+		Min = Max = FVector2f::ZeroVector;
+	}
+
+	CellSize = FMath::Max(InCellSize, 1.f);
+
+	const float Extent = FMath::Max(Max.X - Min.X, Max.Y - Min.Y);
+	if (Extent / CellSize >= MaxGridSize)
+	{
+		const float Scale = FMath::CeilToFloat(Extent / (CellSize * (MaxGridSize - 1)));
+		UE_LOG(LogSkaterHeatmap, Warning, TEXT("Cell size %.0f exceeds %d cells per edge, using %.0f"), CellSize,
+			MaxGridSize, CellSize * Scale);
+		CellSize *= Scale;
+	}
+
+	Origin = Min;
+	Width = FMath::FloorToInt32((Max.X - Min.X) / CellSize) + 1;
+	Height = FMath::FloorToInt32((Max.Y - Min.Y) / CellSize) + 1;
+
+	const int32 NumCells = Width * Height;
+	Pickups.Init(0.f, NumCells);
+	Placements.Init(0.f, NumCells);
+	DwellSeconds.Init(0.f, NumCells);
+	Visits.Init(0.f, NumCells);
+
+	TArray<int32> Cells;
+
+	ComputeCellIndices(Streams.CollectionX, Streams.CollectionY, Cells);
+	Accumulate(Cells, 1.f, Pickups);
+
+	ComputeCellIndices(Streams.PlacementX, Streams.PlacementY, Cells);
+	Accumulate(Cells, 1.f, Placements);
+
+	ComputeCellIndices(Streams.SampleX, Streams.SampleY, Cells);
+	Accumulate(Cells, Streams.SampleInterval, DwellSeconds);
+
+	// A visit starts whenever a skater's sample lands in a different cell than its previous one
+	TMap<uint32, int32> LastCells;
+	for (int32 i = 0; i < Cells.Num(); ++i)
+	{
+		int32& LastCell = LastCells.FindOrAdd(Streams.SampleSkaterIds[i], INDEX_NONE);
+		if (LastCell != Cells[i])
+		{
+			Visits[Cells[i]] += 1.f;
+			LastCell = Cells[i];
+		}
+	}
+}
+
+void FSkaterHeatmap::ComputeCellIndices(const TArray<float>& X, const TArray<float>& Y, TArray<int32>& OutCells) const
+{
+	const int32 Num = X.Num();
+	OutCells.SetNumUninitialized(Num, EAllowShrinking::No);
+
+	const float* RESTRICT XData = X.GetData();
+	const float* RESTRICT YData = Y.GetData();
+	int32* RESTRICT CellData = OutCells.GetData();
+
+	const float InvCellSize = 1.f / CellSize;
+	const int32 MaxX = Width - 1;
+	const int32 MaxY = Height - 1;
+
+	// Straight-line float math with clamps, which the compiler vectorizes
+	for (int32 i = 0; i < Num; ++i)
+	{
+		const int32 CellX = FMath::Clamp(static_cast<int32>((XData[i] - Origin.X) * InvCellSize), 0, MaxX);
+		const int32 CellY = FMath::Clamp(static_cast<int32>((YData[i] - Origin.Y) * InvCellSize), 0, MaxY);
+		CellData[i] = CellY * Width + CellX;
+	}
+}
+
+void FSkaterHeatmap::Accumulate(const TArray<int32>& Cells, float Weight, TArray<float>& Layer)
+{
+	float* LayerData = Layer.GetData();
+	for (const int32 Cell : Cells)
+	{
+		LayerData[Cell] += Weight;
+	}
+}
+
+float FSkaterHeatmap::GetValue(ESkaterHeatmapLayer Layer, int32 CellIndex) const
+{
+	switch (Layer)
+	{
+	case ESkaterHeatmapLayer::Pickups:
+		return Pickups[CellIndex];
+	case ESkaterHeatmapLayer::Placements:
+		return Placements[CellIndex];
+	case ESkaterHeatmapLayer::PickupRate:
+		return Placements[CellIndex] > 0.f ? Pickups[CellIndex] / Placements[CellIndex] : 0.f;
+	case ESkaterHeatmapLayer::DwellTime:
+		return DwellSeconds[CellIndex];
+	case ESkaterHeatmapLayer::Visits:
+		return Visits[CellIndex];
+	default:
+		return 0.f;
+	}
+}
+
+const TCHAR* FSkaterHeatmap::GetLayerName(ESkaterHeatmapLayer Layer)
+{
+	switch (Layer)
+	{
+	case ESkaterHeatmapLayer::Pickups:
+		return TEXT("Pickups");
+	case ESkaterHeatmapLayer::Placements:
+		return TEXT("Placements");
+	case ESkaterHeatmapLayer::PickupRate:
+		return TEXT("PickupRate");
+	case ESkaterHeatmapLayer::DwellTime:
+		return TEXT("DwellTime");
+	case ESkaterHeatmapLayer::Visits:
+		return TEXT("Visits");
+	default:
+		return TEXT("Unknown");
+	}
+}
+
+bool FSkaterHeatmap::ExportCsv(const FString& Path) const
+{
+	TArray<FString> Lines;
+	Lines.Add(TEXT("CellX,CellY,MinX,MinY,Pickups,Placements,PickupRate,DwellTime,Visits"));
+
+	for (int32 CellIndex = 0; CellIndex < Width * Height; ++CellIndex)
+	{
+		if (Pickups[CellIndex] == 0.f && Placements[CellIndex] == 0.f && DwellSeconds[CellIndex] == 0.f)
+		{
+			continue;
+		}
+
+		const int32 CellX = CellIndex % Width;
+		const int32 CellY = CellIndex / Width;
+
+		Lines.Add(FString::Printf(TEXT("%d,%d,%.0f,%.0f,%.0f,%.0f,%.3f,%.2f,%.0f"), CellX, CellY,
+			Origin.X + CellX * CellSize, Origin.Y + CellY * CellSize, Pickups[CellIndex], Placements[CellIndex],
+			GetValue(ESkaterHeatmapLayer::PickupRate, CellIndex), DwellSeconds[CellIndex], Visits[CellIndex]));
+	}
+
+	return SkaterHeatmap::SaveLines(Lines, Path);
+}
+
+bool FSkaterHeatmap::ExportPng(const FString& Path, ESkaterHeatmapLayer Layer) const
+{
+	const int32 NumCells = Width * Height;
+	if (NumCells == 0)
+	{
+		return false;
+	}
+
+	// Rates are fractions; everything else is normalised to its hottest cell
+	float MaxValue = Layer == ESkaterHeatmapLayer::PickupRate ? 1.f : 0.f;
+	for (int32 CellIndex = 0; CellIndex < NumCells; ++CellIndex)
+	{
+		MaxValue = FMath::Max(MaxValue, GetValue(Layer, CellIndex));
+	}
+
+	const float InvMaxValue = MaxValue > 0.f ? 1.f / MaxValue : 0.f;
+
+	TArray<FColor> Pixels;
+	Pixels.SetNumUninitialized(NumCells);
+	for (int32 CellIndex = 0; CellIndex < NumCells; ++CellIndex)
+	{
+		const float Value = GetValue(Layer, CellIndex);
+		Pixels[CellIndex] = Value > 0.f
+			? FLinearColor::LerpUsingHSV(FLinearColor::Blue, FLinearColor::Red, Value * InvMaxValue).ToFColor(true)
+			: FColor::Black;
+	}
+
+	IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+	const TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(EImageFormat::PNG);
+	if (!ImageWrapper || !ImageWrapper->SetRaw(Pixels.GetData(), Pixels.Num() * sizeof(FColor), Width, Height,
+		ERGBFormat::BGRA, 8))
+	{
+		return false;
+	}
+
+	return FFileHelper::SaveArrayToFile(ImageWrapper->GetCompressed(), *Path);
+}
+
+bool FSkaterHeatmap::ExportUnreached(const FSkaterAnalyticsStreams& Streams, const FString& Path,
+	int32& OutNumUnreached)
+{
+	using namespace SkaterHeatmap;
+
+	// Artifacts are collected where they were placed, so exact locations match
+	TSet<FIntVector> Collected;
+	Collected.Reserve(Streams.NumCollections());
+	for (int32 i = 0; i < Streams.NumCollections(); ++i)
+	{
+		Collected.Add(GetLocationKey(Streams.CollectionX[i], Streams.CollectionY[i], Streams.CollectionZ[i]));
+	}
+
+	// Location -> (placement index, spawn count)
+	TMap<FIntVector, TPair<int32, int32>> Unreached;
+	for (int32 i = 0; i < Streams.NumPlacements(); ++i)
+	{
+		const FIntVector Key = GetLocationKey(Streams.PlacementX[i], Streams.PlacementY[i], Streams.PlacementZ[i]);
+		if (!Collected.Contains(Key))
+		{
+			++Unreached.FindOrAdd(Key, TPair<int32, int32>(i, 0)).Value;
+		}
+	}
+
+	TArray<FString> Lines;
+	Lines.Reserve(Unreached.Num() + 1);
+	Lines.Add(TEXT("X,Y,Z,ArtifactDataId,Placements"));
+
+	for (const TPair<FIntVector, TPair<int32, int32>>& Entry : Unreached)
+	{
+		Lines.Add(FString::Printf(TEXT("%d,%d,%d,%08x,%d"), Entry.Key.X, Entry.Key.Y, Entry.Key.Z,
+			Streams.PlacementDataIds[Entry.Value.Key], Entry.Value.Value));
+	}
+
+	OutNumUnreached = Unreached.Num();
+	return SaveLines(Lines, Path);
+}
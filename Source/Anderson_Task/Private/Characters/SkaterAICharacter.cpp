@@ -0,0 +1,25 @@
+#include "Characters/SkaterAICharacter.h"
+
+#include "Camera/CameraComponent.h"
+#include "Components/SplineComponent.h"
+#include "Controllers/SkaterAIController.h"
+#include "GameFramework/SpringArmComponent.h"
+
+ASkaterAICharacter::ASkaterAICharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	AIControllerClass = ASkaterAIController::StaticClass();
+	AutoPossessAI = EAutoPossessAI::PlacedInWorldOrSpawned;
+
+	bUseBatchedMovement = true;
+
+	// Nobody views through a bot; skip the boom's per-frame collision probe
+	CameraBoom->bDoCollisionTest = false;
+	CameraBoom->PrimaryComponentTick.bStartWithTickEnabled = false;
+	FollowCamera->SetAutoActivate(false);
+}
+
+USplineComponent* ASkaterAICharacter::GetRouteSpline() const
+{
+	return RouteActor ? RouteActor->FindComponentByClass<USplineComponent>() : nullptr;
+}
@@ -2,12 +2,22 @@
 
 #include "Camera/CameraComponent.h"
 #include "Components/CapsuleComponent.h"
-#include "GameFramework/CharacterMovementComponent.h"
+#include "Components/SkaterInputRecorderComponent.h"
+#include "Components/SkaterMovementComponent.h"
 #include "GameFramework/SpringArmComponent.h"
+#include "Profiling/SkaterStats.h"
+#include "Profiling/SkaterTrace.h"
+#include "Subsystems/ArtifactRegistrySubsystem.h"
+#include "Subsystems/CollectionAnalyticsSubsystem.h"
+#include "Subsystems/PointSystemCacheSubsystem.h"
+#include "Subsystems/SkaterMovementBatchSubsystem.h"
+#include "Subsystems/SkaterSignificanceSubsystem.h"
 
 DEFINE_LOG_CATEGORY(LogSkaterCharacter);
 
-ASkaterCharacterBase::ASkaterCharacterBase()
+ASkaterCharacterBase::ASkaterCharacterBase(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<USkaterMovementComponent>(
+		ACharacter::CharacterMovementComponentName))
 {
 	PrimaryActorTick.bCanEverTick = true;
 
@@ -40,21 +50,113 @@ ASkaterCharacterBase::ASkaterCharacterBase()
 
 	SkateboardMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("SkateboardMesh"));
 	SkateboardMesh->SetupAttachment(GetMesh(), TEXT("SkateboardSocket"));
+
+	InputRecorder = CreateDefaultSubobject<USkaterInputRecorderComponent>(TEXT("InputRecorder"));
+
+	// Animation update rate scales with screen size; significance throttles it further
+	GetMesh()->bEnableUpdateRateOptimizations = true;
 }
 
 void ASkaterCharacterBase::PostInitializeComponents()
 {
 	Super::PostInitializeComponents();
 
-	CachedMovementComponent = GetCharacterMovement();
+	CachedMovementComponent = Cast<USkaterMovementComponent>(GetCharacterMovement());
 	if (!CachedMovementComponent.IsValid())
 	{
-		UE_LOG(LogSkaterCharacter, Warning, TEXT("%s: CharacterMovementComponent is missing!"), *GetName());
+		UE_LOG(LogSkaterCharacter, Warning, TEXT("%s: SkaterMovementComponent is missing!"), *GetName());
+		return;
+	}
+
+	USkaterMovementComponent* CMC = CachedMovementComponent.Get();
+	CMC->MaxWalkSpeed = MaxSkateSpeed;
+	CMC->GroundFriction = BaseGroundFriction;
+	CMC->TurnRate = TurnRate;
+	CMC->SteeringInterpSpeed = SteeringInterpSpeed;
+	CMC->AccelerateDeceleration = AccelerateDeceleration;
+	CMC->BrakeDeceleration = BrakeDeceleration;
+	CMC->CoastDeceleration = CoastDeceleration;
+}
+
+void ASkaterCharacterBase::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (UArtifactRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UArtifactRegistrySubsystem>())
+	{
+		Registry->RegisterCollector(this);
+	}
+
+	if (UCollectionAnalyticsSubsystem* Analytics = GetWorld()->GetSubsystem<UCollectionAnalyticsSubsystem>())
+	{
+		Analytics->RegisterSkater(this);
+	}
+
+	if (USkaterSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<USkaterSignificanceSubsystem>())
+	{
+		Significance->RegisterSkater(this);
+	}
+
+	UpdateMovementBatching();
+}
+
+void ASkaterCharacterBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UArtifactRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UArtifactRegistrySubsystem>())
+	{
+		Registry->UnregisterCollector(this);
+	}
+
+	if (UCollectionAnalyticsSubsystem* Analytics = GetWorld()->GetSubsystem<UCollectionAnalyticsSubsystem>())
+	{
+		Analytics->UnregisterSkater(this);
+	}
+
+	if (USkaterSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<USkaterSignificanceSubsystem>())
+	{
+		Significance->UnregisterSkater(this);
+	}
+
+	LeaveMovementBatch();
+
+	InvalidatePointSystemCache();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ASkaterCharacterBase::NotifyControllerChanged()
+{
+	Super::NotifyControllerChanged();
+
+	InvalidatePointSystemCache();
+	UpdateMovementBatching();
+}
+
+void ASkaterCharacterBase::OnPlayerStateChanged(APlayerState* NewPlayerState, APlayerState* OldPlayerState)
+{
+	Super::OnPlayerStateChanged(NewPlayerState, OldPlayerState);
+
+	InvalidatePointSystemCache();
+}
+
+void ASkaterCharacterBase::InvalidatePointSystemCache() const
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	if (UPointSystemCacheSubsystem* PointSystemCache = World->GetSubsystem<UPointSystemCacheSubsystem>())
+	{
+		PointSystemCache->Invalidate(this);
 	}
 }
 
 void ASkaterCharacterBase::Tick(float DeltaTime)
 {
+	SCOPE_CYCLE_COUNTER(STAT_SkaterTick);
+
 	Super::Tick(DeltaTime);
 
 	PreMovementUpdate(DeltaTime);
@@ -65,48 +167,90 @@ void ASkaterCharacterBase::Tick(float DeltaTime)
 void ASkaterCharacterBase::SetMovementInput(FVector2D NewInput)
 {
 	CurrentInputVector = NewInput;
+
+	if (MovementBatchHandle != INDEX_NONE)
+	{
+		if (USkaterMovementBatchSubsystem* Batch = GetWorld()->GetSubsystem<USkaterMovementBatchSubsystem>())
+		{
+			Batch->SetInput(MovementBatchHandle, NewInput);
+		}
+	}
+}
+
+void ASkaterCharacterBase::ApplyLookInput(const FVector2D& LookInput)
+{
+	AddControllerYawInput(LookInput.X);
+	AddControllerPitchInput(LookInput.Y);
 }
 
 void ASkaterCharacterBase::ClearMovementInput()
 {
-	CurrentInputVector = FVector2D::ZeroVector;
+	SetMovementInput(FVector2D::ZeroVector);
 }
 
-void ASkaterCharacterBase::UpdateSkaterMovement(float DeltaTime)
+void ASkaterCharacterBase::SetUseBatchedMovement(bool bUseBatch)
 {
-	if (!CachedMovementComponent.IsValid())
+	bUseBatchedMovement = bUseBatch;
+	UpdateMovementBatching();
+}
+
+void ASkaterCharacterBase::UpdateMovementBatching()
+{
+	// Owning-client prediction needs steering inside the saved moves
+	const bool bShouldBatch = bUseBatchedMovement && HasActorBegunPlay() && IsLocallyControlled();
+	if (!bShouldBatch)
+	{
+		LeaveMovementBatch();
+		return;
+	}
+
+	if (MovementBatchHandle != INDEX_NONE)
 	{
 		return;
 	}
 
-	ProcessSteering(DeltaTime);
-	ProcessAcceleration();
+	if (USkaterMovementBatchSubsystem* Batch = GetWorld()->GetSubsystem<USkaterMovementBatchSubsystem>())
+	{
+		MovementBatchHandle = Batch->RegisterSkater(this);
+		Batch->SetInput(MovementBatchHandle, CurrentInputVector);
+	}
 }
 
-void ASkaterCharacterBase::ProcessSteering(float DeltaTime)
+void ASkaterCharacterBase::LeaveMovementBatch()
 {
-	UCharacterMovementComponent* CMC = GetCachedMovementComponent();
-	if (!CMC)
+	if (MovementBatchHandle == INDEX_NONE)
 	{
 		return;
 	}
 
-	const float TargetTurn = CurrentInputVector.X;
-	CurrentTurnValue = FMath::FInterpTo(CurrentTurnValue, TargetTurn, DeltaTime, SteeringInterpSpeed);
+	if (USkaterMovementBatchSubsystem* Batch = GetWorld()->GetSubsystem<USkaterMovementBatchSubsystem>())
+	{
+		Batch->UnregisterSkater(MovementBatchHandle);
+	}
 
-	if (FMath::Abs(CurrentTurnValue) <= TurnDeadzone)
+	MovementBatchHandle = INDEX_NONE;
+}
+
+void ASkaterCharacterBase::UpdateSkaterMovement(float DeltaTime)
+{
+	USkaterMovementComponent* CMC = GetCachedMovementComponent();
+	if (!CMC)
 	{
 		return;
 	}
 
-	const float RotationAmount = CurrentTurnValue * TurnRate * DeltaTime;
-	const FRotator RotationDelta(0.f, RotationAmount, 0.f);
-	AddActorLocalRotation(RotationDelta);
+	// Remote pawns receive their intent through the saved move flags
+	if (IsLocallyControlled())
+	{
+		CMC->SetSkateInput(CurrentInputVector);
+		ProcessAcceleration();
+	}
 
-	if (CMC->IsMovingOnGround())
+	const ESkaterMovementState NewState = CMC->GetSkateState();
+	if (NewState != CurrentMovementState)
 	{
-		CMC->Velocity = RotationDelta.RotateVector(CMC->Velocity);
-		CMC->UpdateComponentVelocity();
+		SKATER_TRACE_MOVEMENT_STATE(this, CurrentMovementState, NewState);
+		CurrentMovementState = NewState;
 	}
 }
 
@@ -114,20 +258,10 @@ void ASkaterCharacterBase::ProcessAcceleration()
 {
 	const float ForwardInput = CurrentInputVector.Y;
 
-	if (ForwardInput > InputDeadzone)
+	if (ForwardInput > USkaterMovementComponent::InputDeadzone)
 	{
-		SetMovementState(ESkaterMovementState::Accelerating);
 		AddMovementInput(GetActorForwardVector(), ForwardInput);
-		return;
-	}
-	
-	if (ForwardInput < -InputDeadzone)
-	{
-		SetMovementState(ESkaterMovementState::Braking);
-		return;
 	}
-
-	SetMovementState(ESkaterMovementState::Coasting);
 }
 
 void ASkaterCharacterBase::SetMovementState(ESkaterMovementState NewState)
@@ -137,28 +271,15 @@ void ASkaterCharacterBase::SetMovementState(ESkaterMovementState NewState)
 		return;
 	}
 
-	UCharacterMovementComponent* CMC = GetCachedMovementComponent();
+	USkaterMovementComponent* CMC = GetCachedMovementComponent();
 	if (!CMC)
 	{
 		return;
 	}
 
+	SKATER_TRACE_MOVEMENT_STATE(this, CurrentMovementState, NewState);
 	CurrentMovementState = NewState;
-
-	switch (NewState)
-	{
-	case ESkaterMovementState::Accelerating:
-		CMC->BrakingDecelerationWalking = AccelerateDeceleration;
-		break;
-	case ESkaterMovementState::Braking:
-		CMC->BrakingDecelerationWalking = BrakeDeceleration;
-		break;
-	case ESkaterMovementState::Coasting:
-		CMC->BrakingDecelerationWalking = CoastDeceleration;
-		break;
-	default:
-		break;
-	}
+	CMC->SetRequestedSkateState(NewState);
 }
 
 float ASkaterCharacterBase::GetSpeedPercent() const
@@ -1,10 +1,12 @@
 #include "Characters/SkaterPlayerCharacter.h"
 
+#include "Components/SkaterInputRecorderComponent.h"
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
 #include "InputActionValue.h"
 
-ASkaterPlayerCharacter::ASkaterPlayerCharacter()
+ASkaterPlayerCharacter::ASkaterPlayerCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
 {
 }
 
@@ -34,6 +36,11 @@ void ASkaterPlayerCharacter::NotifyControllerChanged()
 	}
 
 	Subsystem->AddMappingContext(DefaultMappingContext, 0);
+
+	if (InputRecorder && IsLocallyControlled())
+	{
+		InputRecorder->ApplyCommandLine();
+	}
 }
 
 void ASkaterPlayerCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
@@ -49,9 +56,9 @@ void ASkaterPlayerCharacter::SetupPlayerInputComponent(UInputComponent* PlayerIn
 
 	// Jump
 	Input->BindAction(JumpAction, ETriggerEvent::Started, this, 
-		&ACharacter::Jump);
+		&ASkaterPlayerCharacter::HandleJumpInput);
 	Input->BindAction(JumpAction, ETriggerEvent::Completed, this, 
-		&ACharacter::StopJumping);
+		&ASkaterPlayerCharacter::HandleJumpInputReleased);
 
 	// Movement
 	Input->BindAction(MoveAction, ETriggerEvent::Triggered, this, 
@@ -64,20 +71,69 @@ void ASkaterPlayerCharacter::SetupPlayerInputComponent(UInputComponent* PlayerIn
 		&ASkaterPlayerCharacter::HandleLookInput);
 }
 
+bool ASkaterPlayerCharacter::IsReplayingInput() const
+{
+	return InputRecorder && InputRecorder->IsReplaying();
+}
+
 void ASkaterPlayerCharacter::HandleMoveInput(const FInputActionValue& Value)
 {
-	SetMovementInput(Value.Get<FVector2D>());
+	if (IsReplayingInput())
+	{
+		return;
+	}
+
+	const FVector2D MoveAxisVector = Value.Get<FVector2D>();
+	InputRecorder->RecordMoveInput(MoveAxisVector);
+	SetMovementInput(MoveAxisVector);
 }
 
 void ASkaterPlayerCharacter::HandleMoveInputReleased()
 {
+	if (IsReplayingInput())
+	{
+		return;
+	}
+
+	InputRecorder->RecordMoveInput(FVector2D::ZeroVector);
 	ClearMovementInput();
 }
 
 void ASkaterPlayerCharacter::HandleLookInput(const FInputActionValue& Value)
 {
+	if (IsReplayingInput())
+	{
+		return;
+	}
+
 	const FVector2D LookAxisVector = Value.Get<FVector2D>();
+	InputRecorder->RecordLookInput(LookAxisVector);
+	ApplyLookInput(LookAxisVector);
+}
+
+void ASkaterPlayerCharacter::HandleJumpInput()
+{
+	if (IsReplayingInput())
+	{
+		return;
+	}
+
+	InputRecorder->RecordJumpInput(true);
+	Jump();
+}
 
-	AddControllerYawInput(LookAxisVector.X * LookSensitivity);
-	AddControllerPitchInput(LookAxisVector.Y * LookSensitivity);
+void ASkaterPlayerCharacter::HandleJumpInputReleased()
+{
+	if (IsReplayingInput())
+	{
+		return;
+	}
+
+	InputRecorder->RecordJumpInput(false);
+	StopJumping();
+}
+
+void ASkaterPlayerCharacter::ApplyLookInput(const FVector2D& LookInput)
+{
+	Super::ApplyLookInput(LookInput * LookSensitivity);
 }
\ No newline at end of file
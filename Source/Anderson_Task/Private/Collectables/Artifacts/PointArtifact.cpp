@@ -2,10 +2,20 @@
 
 #include "Collectables/DataAssets/ArtifactData.h"
 #include "Components/CollectionFeedbackComponent.h"
-#include "Components/SphereComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "GameFramework/PlayerState.h"
 #include "Interfaces/PointSystem.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Net/Core/PushModel/PushModel.h"
+#include "Net/UnrealNetwork.h"
+#include "Profiling/SkaterStats.h"
+#include "Profiling/SkaterTrace.h"
+#include "Subsystems/ArtifactCollectionSubsystem.h"
+#include "Subsystems/ArtifactPoolSubsystem.h"
+#include "Subsystems/ArtifactRegistrySubsystem.h"
+#include "Subsystems/ArtifactStreamingSubsystem.h"
+#include "Subsystems/CollectionAnalyticsSubsystem.h"
+#include "Subsystems/PointSystemCacheSubsystem.h"
 
 
 APointArtifact::APointArtifact()
@@ -13,16 +23,16 @@ APointArtifact::APointArtifact()
     PrimaryActorTick.bCanEverTick = false;
     bReplicates = true; 
 
-    // Collision sphere
-    CollisionSphere = CreateDefaultSubobject<USphereComponent>(TEXT("CollisionSphere"));
-    RootComponent = CollisionSphere;
-    CollisionSphere->InitSphereRadius(50.f);
-    CollisionSphere->SetCollisionProfileName(TEXT("OverlapAllDynamic"));
-    CollisionSphere->OnComponentBeginOverlap.AddDynamic(this, &APointArtifact::OnSphereBeginOverlap);
+    // Artifacts only replicate when their collected state changes
+    NetDormancy = DORM_Initial;
+
+    // Root - collection is detected by the artifact registry, no collision primitive needed
+    SceneRoot = CreateDefaultSubobject<USceneComponent>(TEXT("SceneRoot"));
+    RootComponent = SceneRoot;
 
     // Mesh
     MeshComponent = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("MeshComponent"));
-    MeshComponent->SetupAttachment(CollisionSphere);
+    MeshComponent->SetupAttachment(SceneRoot);
     MeshComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
     // Feedback component
@@ -33,30 +43,349 @@ void APointArtifact::PostInitializeComponents()
 {
     Super::PostInitializeComponents();
 
-    SetReplicateMovement(false);
+    // Managed artifacts replicate through the collection manager's bitfield instead of a channel.
+    // Clients never open a channel for them, and SetReplicates warns when called without authority
+    if (UsesCollectionManager())
+    {
+        if (HasAuthority())
+            SetReplicates(false);
+    }
+    // Pooled artifacts move when recycled; dormancy keeps this free while they sit still
+    else
+        SetReplicateMovement(true);
+    ApplyArtifactVisuals();
+}
+
+void APointArtifact::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true;
+
+    DOREPLIFETIME_WITH_PARAMS_FAST(APointArtifact, ArtifactData, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(APointArtifact, bIsActive, Params);
+}
+
+void APointArtifact::ApplyArtifactVisuals()
+{
+    if (!ArtifactData || !MeshComponent)
+        return;
+
+    if (!ArtifactData->AreVisualsLoaded())
+    {
+        // Game worlds stream the visual bundle and apply it on arrival
+        const UWorld* World = GetWorld();
+        if (UArtifactStreamingSubsystem* Streaming = World ? World->GetSubsystem<UArtifactStreamingSubsystem>() : nullptr)
+        {
+            Streaming->RequestVisuals(ArtifactData, FStreamableDelegate::CreateUObject(this,
+                &APointArtifact::OnVisualsLoaded, TWeakObjectPtr<UArtifactData>(ArtifactData)));
+            return;
+        }
+
+        ArtifactData->Mesh.LoadSynchronous();
+        ArtifactData->Material.LoadSynchronous();
+    }
+
+    if (UStaticMesh* Mesh = ArtifactData->Mesh.Get())
+    {
+        MeshComponent->SetStaticMesh(Mesh);
+    }
+
+    if (UMaterialInterface* Material = ArtifactData->Material.Get())
+    {
+        MeshComponent->SetMaterial(0, Material);
+    }
+}
+
+void APointArtifact::OnVisualsLoaded(TWeakObjectPtr<UArtifactData> LoadedData)
+{
+    // Ignore loads for data the artifact was re-keyed away from
+    if (!LoadedData.IsValid() || LoadedData.Get() != ArtifactData || !ArtifactData->AreVisualsLoaded())
+        return;
+
+    ApplyArtifactVisuals();
+
+    if (bUseInstancedRendering && bIsActive && HasActorBegunPlay())
+        AcquireRenderInstance();
+}
+
+void APointArtifact::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (FeedbackComponent)
+        FeedbackComponent->PrewarmFeedback(ArtifactData);
 
-    if (ArtifactData)
+    // Level-placed artifacts honour DORM_Initial; spawned and pooled ones sleep once sent
+    if (HasAuthority() && !IsNetStartupActor())
+        SetNetDormancy(DORM_DormantAll);
+
+    if (UsesCollectionManager())
     {
-        if (UStaticMesh* Mesh = ArtifactData->Mesh)
+        if (UArtifactCollectionSubsystem* Collection = GetWorld()->GetSubsystem<UArtifactCollectionSubsystem>())
         {
-            MeshComponent->SetStaticMesh(Mesh);
+            CollectionIndex = Collection->RegisterArtifact(this);
+            if (!bIsActive)
+                Collection->SetCollected(CollectionIndex, true);
+            // A re-streamed level comes back active; the manager remembers what was collected
+            else if (Collection->IsCollected(CollectionIndex))
+                bIsActive = false;
         }
+    }
+
+    // Late joiners and re-streamed levels receive already collected artifacts
+    if (!bIsActive)
+    {
+        if (ArtifactData && ArtifactData->bIsToPersistAfterCollection)
+        {
+            if (bUseInstancedRendering)
+                AcquireRenderInstance();
 
-        if (UMaterialInterface* Material = ArtifactData->Material)
+            ApplyCollectedVisuals();
+        }
+        else
         {
-            MeshComponent->SetMaterial(0, Material);
+            SetActorHiddenInGame(true);
         }
+        return;
     }
+
+    if (bUseInstancedRendering)
+        AcquireRenderInstance();
+
+    RegisterWithRegistry();
 }
 
-void APointArtifact::OnSphereBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
-    UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+void APointArtifact::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    if (!OtherActor)
+    UnregisterFromRegistry();
+    ReleaseRenderInstance();
+
+    if (UsesCollectionManager())
+    {
+        if (UArtifactCollectionSubsystem* Collection = GetWorld()->GetSubsystem<UArtifactCollectionSubsystem>())
+            Collection->UnregisterArtifact(this);
+
+        CollectionIndex = INDEX_NONE;
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void APointArtifact::ResetArtifact(UArtifactData* NewData, const FTransform& NewTransform)
+{
+    // Wake the dormant artifact so data, state and transform replicate together
+    if (HasActorBegunPlay() && HasAuthority())
+        FlushNetDormancy();
+
+    ArtifactData = NewData;
+    MARK_PROPERTY_DIRTY_FROM_NAME(APointArtifact, ArtifactData, this);
+    SetIsActive(true);
+
+    // Not spawned yet - PostInitializeComponents and BeginPlay set everything up
+    if (!HasActorBegunPlay())
         return;
 
-    if (CanBeCollected_Implementation(OtherActor))
-        OnCollected_Implementation(OtherActor);
+    UnregisterFromRegistry();
+    ReleaseRenderInstance();
+
+    SetActorTransform(NewTransform, false, nullptr, ETeleportType::ResetPhysics);
+
+    ActivateLocally();
+}
+
+void APointArtifact::DeactivateArtifact()
+{
+    SetIsActive(false);
+    DeactivateLocally();
+}
+
+void APointArtifact::SetIsActive(bool bNewActive)
+{
+    if (bIsActive == bNewActive)
+        return;
+
+    // Dormant artifacts must be woken before the change to replicate it
+    if (HasActorBegunPlay() && HasAuthority())
+        FlushNetDormancy();
+
+    bIsActive = bNewActive;
+    MARK_PROPERTY_DIRTY_FROM_NAME(APointArtifact, bIsActive, this);
+
+    if (CollectionIndex != INDEX_NONE)
+    {
+        if (UArtifactCollectionSubsystem* Collection = GetWorld()->GetSubsystem<UArtifactCollectionSubsystem>())
+            Collection->SetCollected(CollectionIndex, !bIsActive);
+    }
+}
+
+void APointArtifact::ApplyReplicatedCollection(bool bCollected, bool bPlayFeedback)
+{
+    if (HasAuthority() || bIsActive != bCollected)
+        return;
+
+    bIsActive = !bCollected;
+    HandleActiveStateReplicated(bPlayFeedback);
+}
+
+void APointArtifact::ActivateLocally()
+{
+    // Drop the faded material left by a persistent collection
+    if (const UMaterialInstanceDynamic* DynMaterial = Cast<UMaterialInstanceDynamic>(MeshComponent->GetMaterial(0)))
+    {
+        MeshComponent->SetMaterial(0, DynMaterial->Parent);
+    }
+
+    ApplyArtifactVisuals();
+    SetActorHiddenInGame(false);
+
+    if (FeedbackComponent)
+        FeedbackComponent->PrewarmFeedback(ArtifactData);
+
+    if (bUseInstancedRendering)
+        AcquireRenderInstance();
+
+    RegisterWithRegistry();
+}
+
+void APointArtifact::DeactivateLocally()
+{
+    UnregisterFromRegistry();
+    ReleaseRenderInstance();
+    SetActorHiddenInGame(true);
+}
+
+void APointArtifact::ApplyCollectedVisuals()
+{
+    if (!ArtifactData)
+        return;
+
+    if (InstanceHandle.IsValid())
+    {
+        UArtifactRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UArtifactRegistrySubsystem>();
+        if (AArtifactInstanceManager* InstanceManager = Registry ? Registry->GetInstanceManager() : nullptr)
+        {
+            InstanceManager->SetInstanceOpacity(InstanceHandle, ArtifactData->OpacityAfterCollection);
+        }
+    }
+    else if (MeshComponent)
+    {
+        if (UMaterialInstanceDynamic* DynMaterial = MeshComponent->CreateAndSetMaterialInstanceDynamic(0))
+        {
+            DynMaterial->SetScalarParameterValue(TEXT("Opacity"), ArtifactData->OpacityAfterCollection);
+        }
+    }
+}
+
+void APointArtifact::OnRep_ArtifactData()
+{
+    ApplyArtifactVisuals();
+
+    if (FeedbackComponent)
+        FeedbackComponent->PrewarmFeedback(ArtifactData);
+
+    // Re-key the registry entry to the new data
+    if (RegistryHandle != INDEX_NONE)
+    {
+        UnregisterFromRegistry();
+        RegisterWithRegistry();
+    }
+}
+
+void APointArtifact::OnRep_IsActive()
+{
+    HandleActiveStateReplicated(true);
+}
+
+void APointArtifact::HandleActiveStateReplicated(bool bPlayFeedback)
+{
+    if (!HasActorBegunPlay())
+        return;
+
+    if (bIsActive)
+    {
+        ReleaseRenderInstance();
+        ActivateLocally();
+        return;
+    }
+
+    // The collection happened on the server; play its feedback locally
+    if (FeedbackComponent && bPlayFeedback)
+        FeedbackComponent->PlayFeedback(ArtifactData);
+
+    if (ArtifactData && ArtifactData->bIsToPersistAfterCollection)
+    {
+        UnregisterFromRegistry();
+        ApplyCollectedVisuals();
+    }
+    else
+    {
+        DeactivateLocally();
+    }
+}
+
+void APointArtifact::RegisterWithRegistry()
+{
+    if (RegistryHandle != INDEX_NONE || !ArtifactData)
+        return;
+
+    if (UArtifactRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UArtifactRegistrySubsystem>())
+    {
+        RegistryHandle = Registry->RegisterArtifact(this, ArtifactData, CollectionRadius);
+    }
+
+    if (RegistryHandle != INDEX_NONE && HasAuthority())
+    {
+        if (UCollectionAnalyticsSubsystem* Analytics = GetWorld()->GetSubsystem<UCollectionAnalyticsSubsystem>())
+            Analytics->RecordPlacement(ArtifactData, GetActorLocation());
+    }
+}
+
+void APointArtifact::UnregisterFromRegistry()
+{
+    if (RegistryHandle == INDEX_NONE)
+        return;
+
+    if (UArtifactRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UArtifactRegistrySubsystem>())
+    {
+        Registry->UnregisterArtifact(RegistryHandle);
+    }
+
+    RegistryHandle = INDEX_NONE;
+}
+
+void APointArtifact::AcquireRenderInstance()
+{
+    // Without a resident mesh the instance is added once the visual bundle arrives
+    if (InstanceHandle.IsValid() || !ArtifactData || !ArtifactData->Mesh.Get())
+        return;
+
+    UArtifactRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UArtifactRegistrySubsystem>();
+    AArtifactInstanceManager* InstanceManager = Registry ? Registry->GetInstanceManager() : nullptr;
+    if (!InstanceManager)
+        return;
+
+    InstanceHandle = InstanceManager->AddInstance(ArtifactData->Mesh.Get(), ArtifactData->Material.Get(),
+        MeshComponent->GetComponentTransform());
+
+    // The batch renders the artifact now, drop the per-actor primitive
+    if (InstanceHandle.IsValid())
+        MeshComponent->SetStaticMesh(nullptr);
+}
+
+void APointArtifact::ReleaseRenderInstance()
+{
+    if (!InstanceHandle.IsValid())
+        return;
+
+    UArtifactRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UArtifactRegistrySubsystem>();
+    if (AArtifactInstanceManager* InstanceManager = Registry ? Registry->GetInstanceManager() : nullptr)
+    {
+        InstanceManager->ReleaseInstance(InstanceHandle);
+    }
+
+    InstanceHandle.Invalidate();
 }
 
 IPointSystem* APointArtifact::FindPointSystemInActor(AActor* Actor)
@@ -77,32 +406,63 @@ IPointSystem* APointArtifact::FindPointSystemInActor(AActor* Actor)
 
 bool APointArtifact::OnCollected_Implementation(AActor* Collector)
 {
+    SCOPE_CYCLE_COUNTER(STAT_ArtifactCollected);
+
     if (!bIsActive || !ArtifactData || !Collector)
         return false;
     
-    IPointSystem* PointSystem = FindPointSystemInActor(Collector);
-    if (!PointSystem) 
-        return false;
-
     const int32 PointValue = Execute_GetPointValue(this);
-    PointSystem->Execute_AddPoints(Cast<UObject>(PointSystem), PointValue);
 
-    bIsActive = false;
+    if (UPointSystemCacheSubsystem* PointSystemCache = GetWorld()->GetSubsystem<UPointSystemCacheSubsystem>())
+    {
+        const FResolvedPointSystem PointSystem = PointSystemCache->Resolve(Collector);
+        if (!PointSystem.IsValid())
+            return false;
+
+        PointSystem.AddPoints(PointValue, GetFName());
+    }
+    else
+    {
+        IPointSystem* PointSystem = FindPointSystemInActor(Collector);
+        if (!PointSystem)
+            return false;
+
+        PointSystem->Execute_AddPoints(Cast<UObject>(PointSystem), PointValue);
+    }
+
+    SKATER_TRACE_COLLECTION(this, Collector, PointValue);
+
+    if (UCollectionAnalyticsSubsystem* Analytics = GetWorld()->GetSubsystem<UCollectionAnalyticsSubsystem>())
+        Analytics->RecordCollection(Collector, ArtifactData, GetActorLocation(), PointValue);
+
+    SetIsActive(false);
+    UnregisterFromRegistry();
 
     if (FeedbackComponent)
     {
         FeedbackComponent->PlayFeedback(ArtifactData);
     }
 
+    UArtifactPoolSubsystem* Pool = GetWorld()->GetSubsystem<UArtifactPoolSubsystem>();
+    const bool bRespawns = Pool && ArtifactData->RespawnDelay > 0.f;
+
     if (!ArtifactData->bIsToPersistAfterCollection)
-        Destroy();
-    else if(MeshComponent)
     {
-        if (UMaterialInstanceDynamic* DynMaterial = MeshComponent->CreateAndSetMaterialInstanceDynamic(0))
-        {
-            DynMaterial->SetScalarParameterValue(TEXT("Opacity"), ArtifactData->OpacityAfterCollection);
-        }
+        // Level-placed artifacts are deactivated where they stand; only spawned ones are recycled
+        if (bRespawns || IsNetStartupActor())
+            DeactivateArtifact();
+        else if (Pool)
+            Pool->ReleaseArtifact(this);
+        else
+            Destroy();
     }
+    else
+    {
+        ApplyCollectedVisuals();
+    }
+
+    if (bRespawns)
+        Pool->ScheduleRespawn(this, ArtifactData->RespawnDelay);
 
     return true;
 }
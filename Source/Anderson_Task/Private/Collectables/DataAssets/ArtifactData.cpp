@@ -1,6 +1,42 @@
 #include "Collectables/DataAssets/ArtifactData.h"
 
+const FPrimaryAssetType UArtifactData::ArtifactAssetType(TEXT("Artifact"));
+const FName UArtifactData::VisualBundle(TEXT("Visual"));
+const FName UArtifactData::FeedbackBundle(TEXT("Feedback"));
+
 FPrimaryAssetId UArtifactData::GetPrimaryAssetId() const
 {
-    return FPrimaryAssetId("Artifact", GetFName());
+    return FPrimaryAssetId(ArtifactAssetType, GetFName());
+}
+
+bool UArtifactData::AreVisualsLoaded() const
+{
+    return (Mesh.IsNull() || Mesh.IsValid()) &&
+           (Material.IsNull() || Material.IsValid());
+}
+
+bool UArtifactData::AreFeedbackAssetsLoaded() const
+{
+    return (CollectionSound.IsNull() || CollectionSound.IsValid()) &&
+           (CollectionEffect.IsNull() || CollectionEffect.IsValid());
+}
+
+void UArtifactData::GetUnloadedBundleAssets(FName Bundle, TArray<FSoftObjectPath>& OutPaths) const
+{
+    auto AddIfUnloaded = [&OutPaths](const auto& Asset)
+    {
+        if (!Asset.IsNull() && !Asset.IsValid())
+            OutPaths.Add(Asset.ToSoftObjectPath());
+    };
+
+    if (Bundle == VisualBundle)
+    {
+        AddIfUnloaded(Mesh);
+        AddIfUnloaded(Material);
+    }
+    else if (Bundle == FeedbackBundle)
+    {
+        AddIfUnloaded(CollectionSound);
+        AddIfUnloaded(CollectionEffect);
+    }
 }
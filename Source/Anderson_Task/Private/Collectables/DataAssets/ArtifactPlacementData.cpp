@@ -0,0 +1,23 @@
+#include "Collectables/DataAssets/ArtifactPlacementData.h"
+
+#include "Collectables/DataAssets/ArtifactData.h"
+
+void UArtifactPlacementData::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	// Raw copy of the 16-byte records; per-element only when the archive byte swaps
+	Placements.BulkSerialize(Ar);
+}
+
+FTransform UArtifactPlacementData::GetPlacementTransform(int32 Index) const
+{
+	const FArtifactPlacement& Placement = Placements[Index];
+	return FTransform(FRotator(0.f, Placement.GetYaw(), 0.f), FVector(Placement.Location));
+}
+
+UArtifactData* UArtifactPlacementData::GetPlacementData(int32 Index) const
+{
+	const int32 TypeIndex = Placements[Index].TypeIndex;
+	return ArtifactTypes.IsValidIndex(TypeIndex) ? ArtifactTypes[TypeIndex].Get() : nullptr;
+}
@@ -0,0 +1,129 @@
+#include "Collectables/Placement/ArtifactPlacementCell.h"
+
+#include "Collectables/Artifacts/PointArtifact.h"
+#include "Collectables/DataAssets/ArtifactPlacementData.h"
+#include "Subsystems/ArtifactPlacementSubsystem.h"
+#include "Subsystems/ArtifactPoolSubsystem.h"
+
+AArtifactPlacementCell::AArtifactPlacementCell()
+{
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+	bReplicates = false;
+
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("SceneRoot"));
+}
+
+void AArtifactPlacementCell::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Non-replicated level actors have authority everywhere; only the server materialises
+	if (GetNetMode() == NM_Client || !PlacementData)
+	{
+		return;
+	}
+
+	Artifacts.SetNum(PlacementData->GetNumPlacements());
+	NextPlacement = 0;
+	bMaterializing = true;
+
+	MaterializeNext();
+}
+
+void AArtifactPlacementCell::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// The pool goes away with the world; only a streamed out or destroyed cell gives artifacts back
+	if (EndPlayReason == EEndPlayReason::RemovedFromWorld || EndPlayReason == EEndPlayReason::Destroyed)
+	{
+		ReleaseArtifacts();
+	}
+
+	Artifacts.Reset();
+	bMaterializing = false;
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AArtifactPlacementCell::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	MaterializeNext();
+}
+
+bool AArtifactPlacementCell::IsFullyMaterialized() const
+{
+	return !bMaterializing;
+}
+
+void AArtifactPlacementCell::MaterializeNext()
+{
+	UWorld* World = GetWorld();
+	UArtifactPoolSubsystem* Pool = World->GetSubsystem<UArtifactPoolSubsystem>();
+	UArtifactPlacementSubsystem* Placement = World->GetSubsystem<UArtifactPlacementSubsystem>();
+	if (!Pool || !Placement || !PlacementData)
+	{
+		bMaterializing = false;
+		SetActorTickEnabled(false);
+		return;
+	}
+
+	const TSubclassOf<APointArtifact> ArtifactClass = PlacementData->ArtifactClass
+		? PlacementData->ArtifactClass : TSubclassOf<APointArtifact>(APointArtifact::StaticClass());
+
+	const int32 LastPlacement = FMath::Min(NextPlacement + PlacementsPerFrame, Artifacts.Num());
+	for (; NextPlacement < LastPlacement; ++NextPlacement)
+	{
+		UArtifactData* Data = PlacementData->GetPlacementData(NextPlacement);
+		if (!Data || Placement->IsCollected(PlacementData, NextPlacement))
+		{
+			continue;
+		}
+
+		APointArtifact* Artifact = Pool->AcquireArtifact(ArtifactClass, Data,
+			PlacementData->GetPlacementTransform(NextPlacement));
+		if (Artifact)
+		{
+			Artifacts[NextPlacement] = Artifact;
+			Placement->TrackArtifact(Artifact, this, NextPlacement);
+		}
+	}
+
+	bMaterializing = NextPlacement < Artifacts.Num();
+	SetActorTickEnabled(bMaterializing);
+}
+
+void AArtifactPlacementCell::ReleaseArtifacts()
+{
+	UWorld* World = GetWorld();
+	UArtifactPoolSubsystem* Pool = World->GetSubsystem<UArtifactPoolSubsystem>();
+	UArtifactPlacementSubsystem* Placement = World->GetSubsystem<UArtifactPlacementSubsystem>();
+
+	for (const TWeakObjectPtr<APointArtifact>& Artifact : Artifacts)
+	{
+		APointArtifact* ArtifactPtr = Artifact.Get();
+		if (!ArtifactPtr)
+		{
+			continue;
+		}
+
+		if (Placement)
+		{
+			Placement->UntrackArtifact(ArtifactPtr);
+		}
+
+		if (Pool)
+		{
+			Pool->ReleaseArtifact(ArtifactPtr);
+		}
+	}
+}
+
+void AArtifactPlacementCell::ForgetArtifact(int32 PlacementIndex)
+{
+	if (Artifacts.IsValidIndex(PlacementIndex))
+	{
+		Artifacts[PlacementIndex].Reset();
+	}
+}
@@ -0,0 +1,566 @@
+#include "Collectables/Placement/ArtifactPlacementGenerator.h"
+
+#include "Collectables/Artifacts/PointArtifact.h"
+#include "Collectables/DataAssets/ArtifactData.h"
+#include "Collectables/DataAssets/ArtifactPlacementData.h"
+#include "Collectables/Placement/ArtifactPlacementCell.h"
+#include "Components/BoxComponent.h"
+#include "Components/SplineComponent.h"
+#include "EngineUtils.h"
+
+#if WITH_EDITOR
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#include "WorldPartition/LoaderAdapter/LoaderAdapterShape.h"
+#include "WorldPartition/WorldPartition.h"
+#include "WorldPartition/WorldPartitionActorDescInstance.h"
+#include "WorldPartition/WorldPartitionHelpers.h"
+#endif
+
+DEFINE_LOG_CATEGORY(LogArtifactPlacement);
+
+#if WITH_EDITOR
+namespace ArtifactPlacement
+{
+	// Candidates tried around an active sample before it is retired
+	constexpr int32 MaxCandidates = 30;
+
+	/**
+	 * Background grid for Poisson-disk sampling. The cell size is MinSpacing / sqrt(Dimensions),
+	 * so each cell holds at most one sample and a spacing check visits a fixed neighbourhood.
+	 */
+	class FPoissonGrid
+	{
+	public:
+		FPoissonGrid(float InMinSpacing, bool bInThreeDimensional)
+			: MinSpacing(InMinSpacing)
+			, CellSize(InMinSpacing / FMath::Sqrt(bInThreeDimensional ? 3.f : 2.f))
+			, bThreeDimensional(bInThreeDimensional)
+		{
+		}
+
+		bool IsFree(const FVector& Location) const
+		{
+			const FIntVector Cell = GetCell(Location);
+			const int32 Reach = FMath::CeilToInt32(MinSpacing / CellSize);
+			const int32 ReachZ = bThreeDimensional ? Reach : 0;
+			const double MinSpacingSquared = FMath::Square(MinSpacing);
+
+			for (int32 Z = -ReachZ; Z <= ReachZ; ++Z)
+			{
+				for (int32 Y = -Reach; Y <= Reach; ++Y)
+				{
+					for (int32 X = -Reach; X <= Reach; ++X)
+					{
+						const int32* Sample = Cells.Find(Cell + FIntVector(X, Y, Z));
+						if (Sample && GetDistanceSquared(Samples[*Sample], Location) < MinSpacingSquared)
+						{
+							return false;
+						}
+					}
+				}
+			}
+
+			return true;
+		}
+
+		int32 Add(const FVector& Location)
+		{
+			const int32 Index = Samples.Add(Location);
+			Cells.Add(GetCell(Location), Index);
+			return Index;
+		}
+
+		const TArray<FVector>& GetSamples() const { return Samples; }
+
+	private:
+		FIntVector GetCell(const FVector& Location) const
+		{
+			return FIntVector(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize),
+				bThreeDimensional ? FMath::FloorToInt32(Location.Z / CellSize) : 0);
+		}
+
+		double GetDistanceSquared(const FVector& A, const FVector& B) const
+		{
+			return bThreeDimensional ? FVector::DistSquared(A, B) : FVector::DistSquared2D(A, B);
+		}
+
+		float MinSpacing;
+
+		float CellSize;
+
+		bool bThreeDimensional;
+
+		TArray<FVector> Samples;
+
+		TMap<FIntVector, int32> Cells;
+	};
+
+	/**
+	 * Fills a box with Bridson's Poisson-disk sampling. In 2D every sample lies on the box's
+	 * bottom face and spacing ignores Z.
+	 */
+	void SampleBox(const FBox& Box, float MinSpacing, bool bThreeDimensional, int32 MaxSamples,
+		FRandomStream& Stream, FPoissonGrid& Grid)
+	{
+		auto RandomInBox = [&Stream, &Box, bThreeDimensional]()
+		{
+			return FVector(Stream.FRandRange(Box.Min.X, Box.Max.X), Stream.FRandRange(Box.Min.Y, Box.Max.Y),
+				bThreeDimensional ? Stream.FRandRange(Box.Min.Z, Box.Max.Z) : Box.Min.Z);
+		};
+
+		auto IsInside = [&Box, bThreeDimensional](const FVector& Location)
+		{
+			return Location.X >= Box.Min.X && Location.X <= Box.Max.X && Location.Y >= Box.Min.Y &&
+				Location.Y <= Box.Max.Y && (!bThreeDimensional || (Location.Z >= Box.Min.Z && Location.Z <= Box.Max.Z));
+		};
+
+		TArray<int32> Active;
+		Active.Add(Grid.Add(RandomInBox()));
+
+		while (Active.Num() > 0 && Grid.GetSamples().Num() < MaxSamples)
+		{
+			const int32 ActiveIndex = Stream.RandHelper(Active.Num());
+			const FVector Origin = Grid.GetSamples()[Active[ActiveIndex]];
+
+			bool bFound = false;
+			for (int32 Attempt = 0; Attempt < MaxCandidates; ++Attempt)
+			{
+				FVector Direction;
+				if (bThreeDimensional)
+				{
+					Direction = Stream.VRand();
+				}
+				else
+				{
+					const float Angle = Stream.FRandRange(0.f, UE_TWO_PI);
+					Direction = FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.f);
+				}
+
+				// Annulus between one and two spacings around the active sample
+				const FVector Candidate = Origin + Direction * MinSpacing * (1.f + Stream.FRand());
+				if (IsInside(Candidate) && Grid.IsFree(Candidate))
+				{
+					Active.Add(Grid.Add(Candidate));
+					bFound = true;
+					break;
+				}
+			}
+
+			if (!bFound)
+			{
+				Active.RemoveAtSwap(ActiveIndex, 1, EAllowShrinking::No);
+			}
+		}
+	}
+}
+#endif
+
+AArtifactPlacementGenerator::AArtifactPlacementGenerator()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	bReplicates = false;
+	bIsEditorOnlyActor = true;
+
+#if WITH_EDITORONLY_DATA
+	// Must stay loaded in World Partition maps to regenerate every cell it covers
+	bIsSpatiallyLoaded = false;
+#endif
+
+	Bounds = CreateDefaultSubobject<UBoxComponent>(TEXT("Bounds"));
+	Bounds->SetBoxExtent(FVector(5000.f, 5000.f, 1000.f));
+	Bounds->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Bounds->SetGenerateOverlapEvents(false);
+	RootComponent = Bounds;
+}
+
+#if WITH_EDITOR
+void AArtifactPlacementGenerator::Generate()
+{
+	const int32 NumPlacements = GenerateAndSave(true);
+	if (NumPlacements != INDEX_NONE)
+	{
+		UE_LOG(LogArtifactPlacement, Display, TEXT("%s generated %d placements in %d assets"), *GetName(),
+			NumPlacements, GeneratedAssets.Num());
+	}
+}
+
+int32 AArtifactPlacementGenerator::GenerateAndSave(bool bSpawnCells, TArray<AArtifactPlacementCell*>* OutSpawnedCells)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return INDEX_NONE;
+	}
+
+	// Partitioned maps only have the geometry inside loaded regions
+	TUniquePtr<FLoaderAdapterShape> LoadedRegion;
+	if (World->IsPartitionedWorld() && Mode != EArtifactDistributionMode::Volume)
+	{
+		LoadedRegion = MakeUnique<FLoaderAdapterShape>(World, Bounds->Bounds.GetBox(), TEXT("Artifact Placement"));
+		LoadedRegion->Load();
+	}
+
+	FRandomStream Stream(Seed);
+
+	TArray<FVector> Locations;
+	SampleLocations(Stream, Locations);
+
+	TArray<FGeneratedPlacement> Placements;
+	Placements.Reserve(Locations.Num());
+
+	for (const FVector& Location : Locations)
+	{
+		// Draw every value for every sample so thinning does not reshuffle the survivors
+		const bool bKeep = Stream.FRand() < Density;
+		const float Yaw = bRandomYaw ? Stream.FRandRange(0.f, 360.f) : GetActorRotation().Yaw;
+		UArtifactData* Data = PickArtifactType(Stream);
+
+		if (bKeep && Data)
+		{
+			FGeneratedPlacement& Placement = Placements.AddDefaulted_GetRef();
+			Placement.Location = Location + FVector(0.f, 0.f, HeightOffset);
+			Placement.Yaw = Yaw;
+			Placement.Data = Data;
+		}
+	}
+
+	if (!SavePlacementAssets(Placements))
+	{
+		return INDEX_NONE;
+	}
+
+	if (bSpawnCells)
+	{
+		TArray<AArtifactPlacementCell*> SpawnedCells;
+		const bool bSpawned = SpawnMissingCells(SpawnedCells);
+
+		if (OutSpawnedCells)
+		{
+			OutSpawnedCells->Append(SpawnedCells);
+		}
+
+		if (!bSpawned)
+		{
+			return INDEX_NONE;
+		}
+	}
+
+	return Placements.Num();
+}
+
+void AArtifactPlacementGenerator::SampleLocations(FRandomStream& Stream, TArray<FVector>& OutLocations) const
+{
+	using namespace ArtifactPlacement;
+
+	if (Mode == EArtifactDistributionMode::Spline)
+	{
+		SampleSplines(Stream, OutLocations);
+		return;
+	}
+
+	const FBox Box = Bounds->Bounds.GetBox();
+	const bool bVolume = Mode == EArtifactDistributionMode::Volume;
+
+	FPoissonGrid Grid(MinSpacing, bVolume);
+	SampleBox(Box, MinSpacing, bVolume, MaxPlacements, Stream, Grid);
+
+	if (bVolume)
+	{
+		OutLocations = Grid.GetSamples();
+		return;
+	}
+
+	OutLocations.Reserve(Grid.GetSamples().Num());
+	for (FVector Location : Grid.GetSamples())
+	{
+		if (ProjectToSurface(Location, Box.Max.Z, Box.Min.Z))
+		{
+			OutLocations.Add(Location);
+		}
+	}
+}
+
+void AArtifactPlacementGenerator::SampleSplines(FRandomStream& Stream, TArray<FVector>& OutLocations) const
+{
+	using namespace ArtifactPlacement;
+
+	// Spacing is checked in 2D so crossing and parallel splines do not crowd each other
+	FPoissonGrid Grid(MinSpacing, false);
+
+	for (const AActor* SourceActor : SourceSplines)
+	{
+		const USplineComponent* Spline = SourceActor ? SourceActor->FindComponentByClass<USplineComponent>() : nullptr;
+		if (!Spline)
+		{
+			continue;
+		}
+
+		const float Length = Spline->GetSplineLength();
+		for (float Distance = Stream.FRand() * MinSpacing; Distance <= Length;
+			Distance += MinSpacing * (1.f + Stream.FRand()))
+		{
+			const FVector Right = Spline->GetRightVectorAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+			const float Lateral = Stream.FRandRange(-0.5f, 0.5f) * SplineWidth;
+
+			FVector Location = Spline->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World) +
+				Right * Lateral;
+
+			if (bProjectSplineToSurface && !ProjectToSurface(Location, Location.Z + MinSpacing, Location.Z - 10000.0))
+			{
+				continue;
+			}
+
+			if (Grid.IsFree(Location))
+			{
+				Grid.Add(Location);
+				OutLocations.Add(Location);
+
+				if (OutLocations.Num() >= MaxPlacements)
+				{
+					return;
+				}
+			}
+		}
+	}
+}
+
+bool AArtifactPlacementGenerator::ProjectToSurface(FVector& Location, double TraceStart, double TraceEnd) const
+{
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(ArtifactPlacement), false, this);
+
+	FHitResult Hit;
+	if (!GetWorld()->LineTraceSingleByChannel(Hit, FVector(Location.X, Location.Y, TraceStart),
+		FVector(Location.X, Location.Y, TraceEnd), TraceChannel, Params))
+	{
+		return false;
+	}
+
+	if (Hit.ImpactNormal.Z < FMath::Cos(FMath::DegreesToRadians(MaxSurfaceSlope)))
+	{
+		return false;
+	}
+
+	Location = Hit.ImpactPoint;
+	return true;
+}
+
+UArtifactData* AArtifactPlacementGenerator::PickArtifactType(FRandomStream& Stream) const
+{
+	float TotalWeight = 0.f;
+	for (const FArtifactTypeWeight& Type : ArtifactTypes)
+	{
+		if (Type.Data)
+		{
+			TotalWeight += FMath::Max(Type.Weight, 0.f);
+		}
+	}
+
+	// Always draw, so the sequence does not depend on the weights
+	float Pick = Stream.FRand() * TotalWeight;
+	if (TotalWeight <= 0.f)
+	{
+		return nullptr;
+	}
+
+	for (const FArtifactTypeWeight& Type : ArtifactTypes)
+	{
+		if (!Type.Data || Type.Weight <= 0.f)
+		{
+			continue;
+		}
+
+		Pick -= Type.Weight;
+		if (Pick < 0.f)
+		{
+			return Type.Data;
+		}
+	}
+
+	// Rounding left the pick on the upper edge
+	for (int32 i = ArtifactTypes.Num() - 1; i >= 0; --i)
+	{
+		if (ArtifactTypes[i].Data && ArtifactTypes[i].Weight > 0.f)
+		{
+			return ArtifactTypes[i].Data;
+		}
+	}
+
+	return nullptr;
+}
+
+bool AArtifactPlacementGenerator::SavePlacementAssets(const TArray<FGeneratedPlacement>& Placements)
+{
+	TMap<FIntPoint, TArray<int32>> PlacementsByCell;
+	for (int32 i = 0; i < Placements.Num(); ++i)
+	{
+		const FIntPoint Cell(FMath::FloorToInt32(Placements[i].Location.X / OutputCellSize),
+			FMath::FloorToInt32(Placements[i].Location.Y / OutputCellSize));
+		PlacementsByCell.FindOrAdd(Cell).Add(i);
+	}
+
+	const FString Prefix = OutputName.IsEmpty() ? GetName() : OutputName;
+
+	// Previously generated assets are emptied unless regenerated below
+	TSet<FSoftObjectPath> StaleAssets;
+	for (const TSoftObjectPtr<UArtifactPlacementData>& Asset : GeneratedAssets)
+	{
+		StaleAssets.Add(Asset.ToSoftObjectPath());
+	}
+
+	PlacementsByCell.KeySort([](const FIntPoint& A, const FIntPoint& B)
+	{
+		return A.Y != B.Y ? A.Y < B.Y : A.X < B.X;
+	});
+
+	// Package name -> placements of its cell, null for a stale asset
+	TArray<TPair<FString, const TArray<int32>*>> Outputs;
+	for (const TPair<FIntPoint, TArray<int32>>& Entry : PlacementsByCell)
+	{
+		Outputs.Emplace(OutputPath / FString::Printf(TEXT("%s_%d_%d"), *Prefix, Entry.Key.X, Entry.Key.Y), &Entry.Value);
+	}
+
+	for (const FSoftObjectPath& Stale : StaleAssets)
+	{
+		const FString PackageName = Stale.GetLongPackageName();
+		if (!Outputs.ContainsByPredicate([&PackageName](const TPair<FString, const TArray<int32>*>& Output)
+		{
+			return Output.Key == PackageName;
+		}))
+		{
+			Outputs.Emplace(PackageName, nullptr);
+		}
+	}
+
+	Modify();
+	GeneratedAssets.Reset();
+
+	bool bSuccess = true;
+	for (const TPair<FString, const TArray<int32>*>& Output : Outputs)
+	{
+		const FString& PackageName = Output.Key;
+		const FString AssetName = FPackageName::GetLongPackageAssetName(PackageName);
+
+		UPackage* Package = FPackageName::DoesPackageExist(PackageName) ? LoadPackage(nullptr, *PackageName, LOAD_None)
+			: nullptr;
+		if (!Package)
+		{
+			Package = CreatePackage(*PackageName);
+		}
+
+		UArtifactPlacementData* Asset = FindObject<UArtifactPlacementData>(Package, *AssetName);
+		const bool bCreated = Asset == nullptr;
+		if (bCreated)
+		{
+			Asset = NewObject<UArtifactPlacementData>(Package, *AssetName, RF_Public | RF_Standalone);
+		}
+
+		Asset->Modify();
+		Asset->ArtifactClass = ArtifactClass ? ArtifactClass : TSubclassOf<APointArtifact>(APointArtifact::StaticClass());
+		Asset->ArtifactTypes.Reset();
+		Asset->Placements.Reset();
+
+		if (const TArray<int32>* CellPlacements = Output.Value)
+		{
+			Asset->Placements.Reserve(CellPlacements->Num());
+			for (const int32 PlacementIndex : *CellPlacements)
+			{
+				const FGeneratedPlacement& Generated = Placements[PlacementIndex];
+
+				FArtifactPlacement& Placement = Asset->Placements.AddDefaulted_GetRef();
+				Placement.Location = FVector3f(Generated.Location);
+				Placement.SetYaw(Generated.Yaw);
+				Placement.TypeIndex = static_cast<uint16>(Asset->ArtifactTypes.AddUnique(Generated.Data));
+			}
+
+			GeneratedAssets.Add(Asset);
+		}
+
+		if (bCreated)
+		{
+			FAssetRegistryModule::AssetCreated(Asset);
+		}
+
+		Package->MarkPackageDirty();
+
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+		SaveArgs.SaveFlags = SAVE_NoError;
+
+		const FString Filename = FPackageName::LongPackageNameToFilename(PackageName,
+			FPackageName::GetAssetPackageExtension());
+		if (!UPackage::SavePackage(Package, Asset, *Filename, SaveArgs))
+		{
+			UE_LOG(LogArtifactPlacement, Error, TEXT("Failed to save %s"), *Filename);
+			bSuccess = false;
+		}
+	}
+
+	return bSuccess;
+}
+
+bool AArtifactPlacementGenerator::SpawnMissingCells(TArray<AArtifactPlacementCell*>& OutSpawnedCells)
+{
+	UWorld* World = GetWorld();
+
+	TSet<const UArtifactPlacementData*> Referenced;
+	for (TActorIterator<AArtifactPlacementCell> It(World); It; ++It)
+	{
+		Referenced.Add(It->GetPlacementData());
+	}
+
+	// Cells outside the loaded regions of a partitioned map are only known by their descriptors
+	if (UWorldPartition* WorldPartition = World->GetWorldPartition())
+	{
+		FWorldPartitionHelpers::FForEachActorWithLoadingParams Params;
+		Params.ActorClasses = { AArtifactPlacementCell::StaticClass() };
+
+		FWorldPartitionHelpers::ForEachActorWithLoading(WorldPartition,
+			[&Referenced](const FWorldPartitionActorDescInstance* ActorDescInstance)
+			{
+				if (const AArtifactPlacementCell* Cell = Cast<AArtifactPlacementCell>(ActorDescInstance->GetActor()))
+				{
+					Referenced.Add(Cell->GetPlacementData());
+				}
+				return true;
+			}, Params);
+	}
+
+	bool bAllSpawned = true;
+
+	for (const TSoftObjectPtr<UArtifactPlacementData>& AssetPtr : GeneratedAssets)
+	{
+		UArtifactPlacementData* Asset = AssetPtr.Get();
+		if (!Asset || Referenced.Contains(Asset) || Asset->GetNumPlacements() == 0)
+		{
+			continue;
+		}
+
+		// Centre of the output cell, so World Partition streams it with the cell
+		const FVector CellOrigin = FVector(Asset->Placements[0].Location);
+		const FVector Location((FMath::FloorToDouble(CellOrigin.X / OutputCellSize) + 0.5) * OutputCellSize,
+			(FMath::FloorToDouble(CellOrigin.Y / OutputCellSize) + 0.5) * OutputCellSize, GetActorLocation().Z);
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		AArtifactPlacementCell* Cell = World->SpawnActor<AArtifactPlacementCell>(Location, FRotator::ZeroRotator,
+			SpawnParams);
+		if (!Cell)
+		{
+			UE_LOG(LogArtifactPlacement, Error, TEXT("%s: failed to spawn a placement cell for %s"), *GetName(),
+				*Asset->GetName());
+			bAllSpawned = false;
+			continue;
+		}
+
+		Cell->PlacementData = Asset;
+		Cell->SetActorLabel(Asset->GetName());
+		OutSpawnedCells.Add(Cell);
+	}
+
+	return bAllSpawned;
+}
+#endif
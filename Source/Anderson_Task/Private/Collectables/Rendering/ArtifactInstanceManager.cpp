@@ -0,0 +1,96 @@
+#include "Collectables/Rendering/ArtifactInstanceManager.h"
+
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Materials/MaterialInterface.h"
+
+AArtifactInstanceManager::AArtifactInstanceManager()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	bReplicates = false;
+
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("SceneRoot"));
+}
+
+FArtifactInstanceHandle AArtifactInstanceManager::AddInstance(UStaticMesh* Mesh, UMaterialInterface* Material,
+	const FTransform& Transform)
+{
+	FArtifactInstanceHandle Handle;
+	if (!Mesh)
+	{
+		return Handle;
+	}
+
+	Handle.BatchIndex = FindOrAddBatch(Mesh, Material);
+	UHierarchicalInstancedStaticMeshComponent* Batch = BatchComponents[Handle.BatchIndex];
+
+	if (FreeInstances[Handle.BatchIndex].Num() > 0)
+	{
+		Handle.InstanceIndex = FreeInstances[Handle.BatchIndex].Pop(EAllowShrinking::No);
+		Batch->UpdateInstanceTransform(Handle.InstanceIndex, Transform, true, true);
+	}
+	else
+	{
+		Handle.InstanceIndex = Batch->AddInstance(Transform, true);
+	}
+
+	Batch->SetCustomDataValue(Handle.InstanceIndex, OpacityCustomDataIndex, 1.f, true);
+	return Handle;
+}
+
+void AArtifactInstanceManager::ReleaseInstance(FArtifactInstanceHandle& Handle)
+{
+	if (!Handle.IsValid() || !BatchComponents.IsValidIndex(Handle.BatchIndex))
+	{
+		Handle.Invalidate();
+		return;
+	}
+
+	// Collapse instead of removing so other instance indices stay valid
+	UHierarchicalInstancedStaticMeshComponent* Batch = BatchComponents[Handle.BatchIndex];
+	FTransform Collapsed;
+	Batch->GetInstanceTransform(Handle.InstanceIndex, Collapsed, true);
+	Collapsed.SetScale3D(FVector::ZeroVector);
+	Batch->UpdateInstanceTransform(Handle.InstanceIndex, Collapsed, true, true);
+
+	FreeInstances[Handle.BatchIndex].Add(Handle.InstanceIndex);
+	Handle.Invalidate();
+}
+
+void AArtifactInstanceManager::SetInstanceOpacity(const FArtifactInstanceHandle& Handle, float Opacity)
+{
+	if (!Handle.IsValid() || !BatchComponents.IsValidIndex(Handle.BatchIndex))
+	{
+		return;
+	}
+
+	BatchComponents[Handle.BatchIndex]->SetCustomDataValue(Handle.InstanceIndex, OpacityCustomDataIndex,
+		Opacity, true);
+}
+
+int32 AArtifactInstanceManager::FindOrAddBatch(UStaticMesh* Mesh, UMaterialInterface* Material)
+{
+	const TPair<const UStaticMesh*, const UMaterialInterface*> Key(Mesh, Material);
+	if (const int32* Existing = BatchLookup.Find(Key))
+	{
+		return *Existing;
+	}
+
+	UHierarchicalInstancedStaticMeshComponent* Batch = NewObject<UHierarchicalInstancedStaticMeshComponent>(this);
+	Batch->SetStaticMesh(Mesh);
+	if (Material)
+	{
+		Batch->SetMaterial(0, Material);
+	}
+	Batch->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Batch->SetCanEverAffectNavigation(false);
+	Batch->NumCustomDataFloats = 1;
+	Batch->SetupAttachment(RootComponent);
+	Batch->RegisterComponent();
+
+	const int32 BatchIndex = BatchComponents.Add(Batch);
+	FreeInstances.AddDefaulted();
+	BatchLookup.Add(Key, BatchIndex);
+
+	return BatchIndex;
+}
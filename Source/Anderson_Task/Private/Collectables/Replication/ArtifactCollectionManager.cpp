@@ -0,0 +1,147 @@
+#include "Collectables/Replication/ArtifactCollectionManager.h"
+
+#include "Net/Core/PushModel/PushModel.h"
+#include "Net/UnrealNetwork.h"
+#include "Subsystems/ArtifactCollectionSubsystem.h"
+
+namespace ArtifactCollection
+{
+	// Upper bound accepted from the network, guards against corrupt chunk indices
+	constexpr int32 MaxChunks = (1 << 20) / FArtifactCollectionChunk::NumBits;
+}
+
+void FArtifactCollectionBits::Set(int32 Index, bool bValue)
+{
+	Bits[Index] = bValue;
+
+	FArtifactCollectionChunk& Chunk = Chunks[Index / FArtifactCollectionChunk::NumBits];
+	const int32 WordIndex = Index / NumBitsPerDWORD;
+	Chunk.Words[WordIndex % FArtifactCollectionChunk::NumWords] = Bits.GetData()[WordIndex];
+	MarkItemDirty(Chunk);
+}
+
+void FArtifactCollectionBits::AddBits(int32 Count)
+{
+	Bits.Add(false, Count);
+
+	while (Chunks.Num() * FArtifactCollectionChunk::NumBits < Bits.Num())
+	{
+		FArtifactCollectionChunk& Chunk = Chunks.AddDefaulted_GetRef();
+		Chunk.ChunkIndex = Chunks.Num() - 1;
+		MarkItemDirty(Chunk);
+	}
+}
+
+void FArtifactCollectionBits::PostReplicatedAdd(const TArrayView<int32>& AddedIndices, int32 FinalSize)
+{
+	for (const int32 Index : AddedIndices)
+	{
+		ApplyChunk(Chunks[Index]);
+	}
+}
+
+void FArtifactCollectionBits::PostReplicatedChange(const TArrayView<int32>& ChangedIndices, int32 FinalSize)
+{
+	for (const int32 Index : ChangedIndices)
+	{
+		ApplyChunk(Chunks[Index]);
+	}
+}
+
+void FArtifactCollectionBits::ApplyChunk(const FArtifactCollectionChunk& Chunk)
+{
+	if (Chunk.ChunkIndex < 0 || Chunk.ChunkIndex >= ArtifactCollection::MaxChunks)
+	{
+		return;
+	}
+
+	const int32 NumBitsNeeded = (Chunk.ChunkIndex + 1) * FArtifactCollectionChunk::NumBits;
+	if (Bits.Num() < NumBitsNeeded)
+	{
+		Bits.Add(false, NumBitsNeeded - Bits.Num());
+	}
+
+	FMemory::Memcpy(Bits.GetData() + Chunk.ChunkIndex * FArtifactCollectionChunk::NumWords, Chunk.Words, sizeof(Chunk.Words));
+}
+
+AArtifactCollectionManager::AArtifactCollectionManager()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	bReplicates = true;
+	bAlwaysRelevant = true;
+
+	// State only changes on collection and is pushed explicitly
+	SetNetUpdateFrequency(10.f);
+}
+
+void AArtifactCollectionManager::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(AArtifactCollectionManager, LevelBlocks, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AArtifactCollectionManager, CollectedBits, Params);
+}
+
+int32 AArtifactCollectionManager::ReserveLevelBlock(FName LevelName, int32 Num)
+{
+	int32 ExistingNum = 0;
+	const int32 ExistingFirst = FindLevelBlock(LevelName, ExistingNum);
+	if (ExistingFirst != INDEX_NONE)
+	{
+		if (ExistingNum != Num)
+		{
+			UE_LOG(LogArtifactCollection, Warning, TEXT("Level %s changed its managed artifact count from %d to %d"),
+				*LevelName.ToString(), ExistingNum, Num);
+		}
+		return ExistingFirst;
+	}
+
+	FArtifactCollectionLevelBlock& Block = LevelBlocks.AddDefaulted_GetRef();
+	Block.LevelName = LevelName;
+	Block.FirstIndex = CollectedBits.Num();
+	Block.Num = Num;
+
+	CollectedBits.AddBits(Num);
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(AArtifactCollectionManager, LevelBlocks, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(AArtifactCollectionManager, CollectedBits, this);
+
+	return Block.FirstIndex;
+}
+
+int32 AArtifactCollectionManager::FindLevelBlock(FName LevelName, int32& OutNum) const
+{
+	for (const FArtifactCollectionLevelBlock& Block : LevelBlocks)
+	{
+		if (Block.LevelName == LevelName)
+		{
+			OutNum = Block.Num;
+			return Block.FirstIndex;
+		}
+	}
+
+	OutNum = 0;
+	return INDEX_NONE;
+}
+
+void AArtifactCollectionManager::SetCollected(int32 Index, bool bCollected)
+{
+	if (!CollectedBits.GetBits().IsValidIndex(Index) || CollectedBits.Get(Index) == bCollected)
+	{
+		return;
+	}
+
+	CollectedBits.Set(Index, bCollected);
+	MARK_PROPERTY_DIRTY_FROM_NAME(AArtifactCollectionManager, CollectedBits, this);
+}
+
+void AArtifactCollectionManager::OnRep_CollectionState()
+{
+	if (UArtifactCollectionSubsystem* Subsystem = GetWorld()->GetSubsystem<UArtifactCollectionSubsystem>())
+	{
+		Subsystem->HandleManagerReplicated(this);
+	}
+}
@@ -0,0 +1,162 @@
+#include "Commandlets/ArtifactPlacementCommandlet.h"
+
+#include "Collectables/Placement/ArtifactPlacementCell.h"
+#include "Collectables/Placement/ArtifactPlacementGenerator.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+#if WITH_EDITOR
+namespace ArtifactPlacementCommandlet
+{
+	/**
+	 * Saves the package holding an actor: its external package in a partitioned map, the map
+	 * package otherwise.
+	 */
+	bool SaveActorPackage(AActor* Actor, UWorld* World, UPackage* MapPackage)
+	{
+		UPackage* Package = Actor->GetPackage();
+		const bool bInMapPackage = Package == MapPackage;
+
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = bInMapPackage ? RF_Standalone : RF_NoFlags;
+		SaveArgs.SaveFlags = SAVE_NoError;
+
+		const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(),
+			bInMapPackage ? FPackageName::GetMapPackageExtension() : FPackageName::GetAssetPackageExtension());
+		UObject* SaveBase = bInMapPackage ? static_cast<UObject*>(World) : static_cast<UObject*>(Actor);
+		if (!UPackage::SavePackage(Package, SaveBase, *Filename, SaveArgs))
+		{
+			UE_LOG(LogArtifactPlacement, Error, TEXT("Failed to save %s"), *Filename);
+			return false;
+		}
+
+		return true;
+	}
+}
+#endif
+
+UArtifactPlacementCommandlet::UArtifactPlacementCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UArtifactPlacementCommandlet::Main(const FString& Params)
+{
+#if WITH_EDITOR
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamValues;
+	ParseCommandLine(*Params, Tokens, Switches, ParamValues);
+
+	const FString* MapParam = ParamValues.Find(TEXT("Map"));
+	if (!MapParam)
+	{
+		UE_LOG(LogArtifactPlacement, Error, TEXT("Missing -Map=/Game/Path/To/Map"));
+		return 1;
+	}
+
+	const FString* GeneratorParam = ParamValues.Find(TEXT("Generator"));
+	const FString* SeedParam = ParamValues.Find(TEXT("Seed"));
+
+	UPackage* MapPackage = LoadPackage(nullptr, **MapParam, LOAD_None);
+	UWorld* World = MapPackage ? UWorld::FindWorldInPackage(MapPackage) : nullptr;
+	if (!World)
+	{
+		UE_LOG(LogArtifactPlacement, Error, TEXT("Failed to load map %s"), **MapParam);
+		return 1;
+	}
+
+	// Surface projection needs collision, nothing else
+	World->AddToRoot();
+	World->WorldType = EWorldType::Editor;
+	World->InitWorld(UWorld::InitializationValues()
+		.InitializeScenes(false)
+		.AllowAudioPlayback(false)
+		.RequiresHitProxies(false)
+		.CreatePhysicsScene(true)
+		.CreateNavigation(false)
+		.CreateAISystem(false)
+		.ShouldSimulatePhysics(false)
+		.EnableTraceCollision(true)
+		.SetTransactional(false)
+		.CreateFXSystem(false));
+	World->UpdateWorldComponents(true, false);
+
+	int32 NumGenerators = 0;
+	int32 NumFailures = 0;
+
+	for (TActorIterator<AArtifactPlacementGenerator> It(World); It; ++It)
+	{
+		AArtifactPlacementGenerator* Generator = *It;
+		if (GeneratorParam && Generator->GetName() != *GeneratorParam && Generator->GetActorLabel() != *GeneratorParam)
+		{
+			continue;
+		}
+
+		if (SeedParam)
+		{
+			Generator->Seed = FCString::Atoi(**SeedParam);
+		}
+
+		++NumGenerators;
+
+		const double StartTime = FPlatformTime::Seconds();
+		TArray<AArtifactPlacementCell*> SpawnedCells;
+		const int32 NumPlacements = Generator->GenerateAndSave(true, &SpawnedCells);
+		if (NumPlacements == INDEX_NONE)
+		{
+			++NumFailures;
+			continue;
+		}
+
+		UE_LOG(LogArtifactPlacement, Display, TEXT("%s: %d placements in %d assets, %d new cells (%.2fs)"),
+			*Generator->GetActorLabel(), NumPlacements, Generator->GeneratedAssets.Num(), SpawnedCells.Num(),
+			FPlatformTime::Seconds() - StartTime);
+
+		// Keep the generator's asset list, so the next run can empty stale cells. New cells are
+		// external actors in partitioned maps and are saved one package each; otherwise they
+		// share the map package, which is saved once
+		TSet<UPackage*> SavedPackages;
+		TArray<AActor*> ActorsToSave;
+		ActorsToSave.Add(Generator);
+		ActorsToSave.Append(SpawnedCells);
+
+		for (AActor* Actor : ActorsToSave)
+		{
+			bool bAlreadySaved = false;
+			SavedPackages.Add(Actor->GetPackage(), &bAlreadySaved);
+			if (!bAlreadySaved && !ArtifactPlacementCommandlet::SaveActorPackage(Actor, World, MapPackage))
+			{
+				++NumFailures;
+			}
+		}
+	}
+
+	World->CleanupWorld();
+	World->RemoveFromRoot();
+
+	if (NumGenerators == 0)
+	{
+		UE_LOG(LogArtifactPlacement, Error, TEXT("No artifact placement generator%s in %s"),
+			GeneratorParam ? *FString::Printf(TEXT(" named %s"), **GeneratorParam) : TEXT(""), **MapParam);
+		return 1;
+	}
+
+	if (NumFailures > 0)
+	{
+		UE_LOG(LogArtifactPlacement, Error, TEXT("%d generator(s) failed"), NumFailures);
+		return 1;
+	}
+
+	return 0;
+#else
+	UE_LOG(LogArtifactPlacement, Error, TEXT("ArtifactPlacement requires an editor build"));
+	return 1;
+#endif
+}
@@ -0,0 +1,136 @@
+#include "Commandlets/SkaterHeatmapCommandlet.h"
+
+#include "Analytics/SkaterHeatmap.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+namespace SkaterHeatmapCommandlet
+{
+	/**
+	 * Extracts the map from a log name of the form <Map>_<Timestamp>_<Index>.
+	 */
+	FString GetMapName(const FString& FileName)
+	{
+		FString Session;
+		FString Map;
+		FString Unused;
+		if (!FPaths::GetBaseFilename(FileName).Split(TEXT("_"), &Session, &Unused, ESearchCase::CaseSensitive,
+			ESearchDir::FromEnd) || !Session.Split(TEXT("_"), &Map, &Unused, ESearchCase::CaseSensitive,
+			ESearchDir::FromEnd))
+		{
+			return FString();
+		}
+
+		return Map;
+	}
+}
+
+USkaterHeatmapCommandlet::USkaterHeatmapCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 USkaterHeatmapCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamValues;
+	ParseCommandLine(*Params, Tokens, Switches, ParamValues);
+
+	const FString* InputParam = ParamValues.Find(TEXT("Input"));
+	const FString InputDir = InputParam ? *InputParam : FPaths::ProjectSavedDir() / TEXT("Analytics");
+
+	const FString* OutputParam = ParamValues.Find(TEXT("Output"));
+	const FString OutputDir = OutputParam ? *OutputParam : FPaths::ProjectSavedDir() / TEXT("Analytics/Heatmaps");
+
+	const FString* MapParam = ParamValues.Find(TEXT("Map"));
+
+	const FString* CellSizeParam = ParamValues.Find(TEXT("CellSize"));
+	const float CellSizeOverride = CellSizeParam ? FCString::Atof(**CellSizeParam) : 0.f;
+
+	const bool bWritePng = !Switches.Contains(TEXT("NoPng"));
+
+	TArray<FString> FileNames;
+	IFileManager::Get().FindFiles(FileNames, *(InputDir / TEXT("*.bin")), true, false);
+
+	// Sorted names keep each session's files in write order
+	TMap<FString, TArray<FString>> FilesByMap;
+	for (const FString& FileName : FileNames)
+	{
+		const FString Map = SkaterHeatmapCommandlet::GetMapName(FileName);
+		if (!Map.IsEmpty() && (!MapParam || Map == *MapParam))
+		{
+			FilesByMap.FindOrAdd(Map).Add(InputDir / FileName);
+		}
+	}
+
+	if (FilesByMap.IsEmpty())
+	{
+		UE_LOG(LogSkaterHeatmap, Error, TEXT("No analytics logs%s in %s"),
+			MapParam ? *FString::Printf(TEXT(" for %s"), **MapParam) : TEXT(""), *InputDir);
+		return 1;
+	}
+
+	int32 NumFailures = 0;
+	for (TPair<FString, TArray<FString>>& Entry : FilesByMap)
+	{
+		const FString& Map = Entry.Key;
+		Entry.Value.Sort();
+
+		FSkaterAnalyticsStreams Streams;
+		for (const FString& Path : Entry.Value)
+		{
+			Streams.LoadLogFile(Path);
+		}
+
+		const float CellSize = CellSizeOverride > 0.f ? CellSizeOverride
+			: Streams.LogCellSize > 0.f ? Streams.LogCellSize : 1000.f;
+
+		FSkaterHeatmap Heatmap;
+		Heatmap.Build(Streams, CellSize);
+
+		UE_LOG(LogSkaterHeatmap, Display, TEXT("%s: %d files, %d collections, %d placements, %d samples, %dx%d cells of %.0f"),
+			*Map, Entry.Value.Num(), Streams.NumCollections(), Streams.NumPlacements(), Streams.NumSamples(),
+			Heatmap.GetWidth(), Heatmap.GetHeight(), Heatmap.GetCellSize());
+
+		const FString MapOutputDir = OutputDir / Map;
+
+		if (!Heatmap.ExportCsv(MapOutputDir / TEXT("Heatmap.csv")))
+		{
+			UE_LOG(LogSkaterHeatmap, Error, TEXT("Failed to write %s"), *(MapOutputDir / TEXT("Heatmap.csv")));
+			++NumFailures;
+		}
+
+		if (bWritePng)
+		{
+			for (uint8 Layer = 0; Layer < static_cast<uint8>(ESkaterHeatmapLayer::Num); ++Layer)
+			{
+				const FString PngPath = MapOutputDir /
+					FString::Printf(TEXT("%s.png"), FSkaterHeatmap::GetLayerName(static_cast<ESkaterHeatmapLayer>(Layer)));
+				if (!Heatmap.ExportPng(PngPath, static_cast<ESkaterHeatmapLayer>(Layer)))
+				{
+					UE_LOG(LogSkaterHeatmap, Error, TEXT("Failed to write %s"), *PngPath);
+					++NumFailures;
+				}
+			}
+		}
+
+		int32 NumUnreached = 0;
+		if (FSkaterHeatmap::ExportUnreached(Streams, MapOutputDir / TEXT("Unreached.csv"), NumUnreached))
+		{
+			UE_LOG(LogSkaterHeatmap, Display, TEXT("%s: %d artifact locations never collected"), *Map, NumUnreached);
+		}
+		else
+		{
+			UE_LOG(LogSkaterHeatmap, Error, TEXT("Failed to write %s"), *(MapOutputDir / TEXT("Unreached.csv")));
+			++NumFailures;
+		}
+
+		UE_LOG(LogSkaterHeatmap, Display, TEXT("%s: heatmaps written to %s"), *Map, *MapOutputDir);
+	}
+
+	return NumFailures > 0 ? 1 : 0;
+}
@@ -1,38 +1,30 @@
 #include "Components/CollectionFeedbackComponent.h"
 #include "Collectables/DataAssets/ArtifactData.h"
-#include "Kismet/GameplayStatics.h"
-#include "NiagaraFunctionLibrary.h"
-#include "NiagaraComponent.h"
-#include "Particles/ParticleSystemComponent.h"
+#include "Profiling/SkaterStats.h"
 #include "TimerManager.h"
-#include "Components/AudioComponent.h"
+
+void UCollectionFeedbackComponent::PrewarmFeedback(const UArtifactData* Data)
+{
+    if (UFeedbackPoolSubsystem* Pool = GetFeedbackPool())
+    {
+        Pool->PrewarmFeedback(Data);
+    }
+}
 
 void UCollectionFeedbackComponent::PlayFeedback(const UArtifactData* Data)
 {
+    SCOPE_CYCLE_COUNTER(STAT_CollectionFeedback);
+
     if (!Data || !GetWorld())
         return;
 
     StopFeedback();
 
-    if (USoundBase* Sound = Data->CollectionSound)
-    {
-        AudioComp = UGameplayStatics::SpawnSoundAtLocation(this, Sound, 
-            GetOwner()->GetActorLocation());
-    }
+    UFeedbackPoolSubsystem* Pool = GetFeedbackPool();
+    if (!Pool)
+        return;
 
-    if (UFXSystemAsset* VFXAsset = Data->CollectionEffect)
-    {
-        if (UNiagaraSystem* NiagaraSystem = Cast<UNiagaraSystem>(VFXAsset))
-        {
-            NiagaraComp = UNiagaraFunctionLibrary::SpawnSystemAtLocation(GetWorld(), NiagaraSystem,
-                GetOwner()->GetActorLocation(), GetOwner()->GetActorRotation());
-        }
-        else if (UParticleSystem* ParticleSystem = Cast<UParticleSystem>(VFXAsset))
-        {
-            ParticleComp = UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), ParticleSystem, 
-                GetOwner()->GetActorTransform());
-        }
-    }
+    ActiveFeedback = Pool->PlayFeedback(Data, GetOwner()->GetActorTransform());
 
     if (Data->EffectDuration > 0.f)
     {
@@ -42,25 +34,9 @@ void UCollectionFeedbackComponent::PlayFeedback(const UArtifactData* Data)
 
 void UCollectionFeedbackComponent::StopFeedback()
 {
-    if (AudioComp)
-    {
-        AudioComp->Stop();
-        AudioComp->DestroyComponent();
-        AudioComp = nullptr;
-    }
-
-    if (NiagaraComp)
-    {
-        NiagaraComp->Deactivate();
-        NiagaraComp->DestroyComponent();
-        NiagaraComp = nullptr;
-    }
-
-    if (ParticleComp)
+    if (UFeedbackPoolSubsystem* Pool = GetFeedbackPool())
     {
-        ParticleComp->DeactivateSystem();
-        ParticleComp->DestroyComponent();
-        ParticleComp = nullptr;
+        Pool->StopFeedback(ActiveFeedback);
     }
 
     if (GetWorld())
@@ -77,3 +53,9 @@ void UCollectionFeedbackComponent::ScheduleStop(float Duration)
     GetWorld()->GetTimerManager().SetTimer(StopTimerHandle, this,
         &UCollectionFeedbackComponent::StopFeedback, Duration, false);
 }
+
+UFeedbackPoolSubsystem* UCollectionFeedbackComponent::GetFeedbackPool() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetSubsystem<UFeedbackPoolSubsystem>() : nullptr;
+}
@@ -0,0 +1,376 @@
+#include "Components/SkaterInputRecorderComponent.h"
+
+#include "Characters/SkaterCharacterBase.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+DEFINE_LOG_CATEGORY(LogSkaterInputRecorder);
+
+namespace SkaterInputRecording
+{
+	int16 QuantizeAxis(float Value)
+	{
+		return static_cast<int16>(FMath::RoundToInt32(FMath::Clamp(Value, -1.f, 1.f) * MAX_int16));
+	}
+
+	float DequantizeAxis(int16 Value)
+	{
+		return static_cast<float>(Value) / MAX_int16;
+	}
+}
+
+FArchive& operator<<(FArchive& Ar, FSkaterInputFrame& Frame)
+{
+	int16 MoveX = SkaterInputRecording::QuantizeAxis(Frame.Move.X);
+	int16 MoveY = SkaterInputRecording::QuantizeAxis(Frame.Move.Y);
+
+	Ar << Frame.Time;
+	Ar << MoveX;
+	Ar << MoveY;
+	Ar << Frame.Look.X;
+	Ar << Frame.Look.Y;
+	Ar << Frame.Buttons;
+
+	if (Ar.IsLoading())
+	{
+		Frame.Move = FVector2f(SkaterInputRecording::DequantizeAxis(MoveX), SkaterInputRecording::DequantizeAxis(MoveY));
+	}
+
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FSkaterInputRecording& Recording)
+{
+	uint32 Magic = FSkaterInputRecording::Magic;
+	uint16 Version = FSkaterInputRecording::Version;
+	int32 NumFrames = Recording.Frames.Num();
+
+	Ar << Magic;
+	Ar << Version;
+	Ar << NumFrames;
+
+	if (Ar.IsLoading())
+	{
+		// 17 bytes per frame; reject headers claiming more than the file holds
+		const int64 Remaining = Ar.TotalSize() - Ar.Tell();
+		if (Magic != FSkaterInputRecording::Magic || Version != FSkaterInputRecording::Version ||
+			NumFrames < 0 || NumFrames > Remaining / 17)
+		{
+			Ar.SetError();
+			return Ar;
+		}
+
+		Recording.Frames.SetNum(NumFrames);
+	}
+
+	for (FSkaterInputFrame& Frame : Recording.Frames)
+	{
+		Ar << Frame;
+	}
+
+	return Ar;
+}
+
+bool FSkaterInputRecording::SaveToFile(const FString& Path) const
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	Writer << const_cast<FSkaterInputRecording&>(*this);
+
+	return !Writer.IsError() && FFileHelper::SaveArrayToFile(Bytes, *Path);
+}
+
+bool FSkaterInputRecording::LoadFromFile(const FString& Path)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Path))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+	Reader << *this;
+
+	if (Reader.IsError())
+	{
+		Frames.Reset();
+		return false;
+	}
+
+	return Frames.Num() > 0;
+}
+
+USkaterInputRecorderComponent::USkaterInputRecorderComponent()
+{
+	// After the owner and its controller, before the movement batch; ticks only while in use
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+}
+
+void USkaterInputRecorderComponent::ApplyCommandLine()
+{
+	const TCHAR* CommandLine = FCommandLine::Get();
+
+	FString Path;
+	if (!bReplaying && FParse::Value(CommandLine, TEXT("SkaterReplayInput="), Path))
+	{
+		if (!StartReplayFromFile(Path, true))
+		{
+			UE_LOG(LogSkaterInputRecorder, Warning, TEXT("Could not read input recording '%s'"), *Path);
+		}
+	}
+	else if (!bRecording && FParse::Value(CommandLine, TEXT("SkaterRecordInput="), Path))
+	{
+		StartRecording(Path);
+	}
+}
+
+void USkaterInputRecorderComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	StopRecording();
+	StopReplay();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void USkaterInputRecorderComponent::TickComponent(float DeltaTime, ELevelTick TickType,
+	FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (bRecording)
+	{
+		RecordFrame();
+	}
+
+	if (bReplaying)
+	{
+		AdvanceReplay(DeltaTime);
+	}
+}
+
+void USkaterInputRecorderComponent::StartRecording(const FString& SavePath)
+{
+	StopReplay();
+
+	Recording.Frames.Reset();
+	RecordingPath = SavePath;
+	RecordingStartTime = GetWorld()->GetTimeSeconds();
+
+	PendingMove = FVector2f::ZeroVector;
+	PendingLook = FVector2f::ZeroVector;
+	PendingButtons = 0;
+
+	bRecording = true;
+	UpdateTickEnabled();
+
+	UE_LOG(LogSkaterInputRecorder, Log, TEXT("%s: Recording input"), *GetNameSafe(GetOwner()));
+}
+
+void USkaterInputRecorderComponent::StopRecording()
+{
+	if (!bRecording)
+	{
+		return;
+	}
+
+	bRecording = false;
+	UpdateTickEnabled();
+
+	if (RecordingPath.IsEmpty())
+	{
+		return;
+	}
+
+	if (Recording.SaveToFile(RecordingPath))
+	{
+		UE_LOG(LogSkaterInputRecorder, Log, TEXT("Recorded %d frames (%.1fs) to %s"), Recording.Frames.Num(),
+			Recording.GetDuration(), *RecordingPath);
+	}
+	else
+	{
+		UE_LOG(LogSkaterInputRecorder, Error, TEXT("Failed to write input recording to %s"), *RecordingPath);
+	}
+}
+
+void USkaterInputRecorderComponent::StartReplay(const FSkaterInputRecording& InRecording, bool bInLoop)
+{
+	StopRecording();
+
+	Recording = InRecording;
+	bLoop = bInLoop;
+	ReplayTime = 0.0;
+	ReplayAccumulator = 0.f;
+	ReplayFrameIndex = 0;
+	ReplayMove = FVector2D::ZeroVector;
+	PendingReplayEdges.Reset();
+
+	bReplaying = Recording.Frames.Num() > 0;
+	UpdateTickEnabled();
+}
+
+bool USkaterInputRecorderComponent::StartReplayFromFile(const FString& Path, bool bInLoop)
+{
+	FSkaterInputRecording Loaded;
+	if (!Loaded.LoadFromFile(Path))
+	{
+		return false;
+	}
+
+	StartReplay(Loaded, bInLoop);
+
+	UE_LOG(LogSkaterInputRecorder, Log, TEXT("%s: Replaying %d frames (%.1fs) from %s"),
+		*GetNameSafe(GetOwner()), Recording.Frames.Num(), Recording.GetDuration(), *Path);
+	return true;
+}
+
+void USkaterInputRecorderComponent::StopReplay()
+{
+	if (!bReplaying)
+	{
+		return;
+	}
+
+	bReplaying = false;
+	UpdateTickEnabled();
+	PendingReplayEdges.Reset();
+
+	if (ASkaterCharacterBase* Skater = GetSkater())
+	{
+		Skater->SetMovementInput(FVector2D::ZeroVector);
+		Skater->StopJumping();
+	}
+}
+
+void USkaterInputRecorderComponent::RecordMoveInput(const FVector2D& Value)
+{
+	PendingMove = FVector2f(Value);
+}
+
+void USkaterInputRecorderComponent::RecordLookInput(const FVector2D& Value)
+{
+	PendingLook += FVector2f(Value);
+}
+
+void USkaterInputRecorderComponent::RecordJumpInput(bool bPressed)
+{
+	PendingButtons |= bPressed ? FSkaterInputFrame::JumpPressed : FSkaterInputFrame::JumpReleased;
+}
+
+void USkaterInputRecorderComponent::RecordFrame()
+{
+	FSkaterInputFrame& Frame = Recording.Frames.AddDefaulted_GetRef();
+	Frame.Time = static_cast<float>(GetWorld()->GetTimeSeconds() - RecordingStartTime);
+	Frame.Move = PendingMove;
+	Frame.Look = PendingLook;
+	Frame.Buttons = PendingButtons;
+
+	// Move holds its value until released; look and buttons are per frame
+	PendingLook = FVector2f::ZeroVector;
+	PendingButtons = 0;
+}
+
+void USkaterInputRecorderComponent::AdvanceReplay(float DeltaTime)
+{
+	const TArray<FSkaterInputFrame>& Frames = Recording.Frames;
+
+	ReplayAccumulator += DeltaTime;
+
+	// Every frame recorded up to the last step's end is consumed exactly once, in order. Movement
+	// only runs once per tick, so the frames are merged and applied together below
+	FVector2D Look = FVector2D::ZeroVector;
+
+	int32 Steps = 0;
+	while (ReplayAccumulator >= ReplayTimestep && Steps < MaxReplayStepsPerTick)
+	{
+		ReplayAccumulator -= ReplayTimestep;
+		ReplayTime += ReplayTimestep;
+		++Steps;
+
+		while (Frames.IsValidIndex(ReplayFrameIndex) && Frames[ReplayFrameIndex].Time <= ReplayTime)
+		{
+			const FSkaterInputFrame& Frame = Frames[ReplayFrameIndex++];
+			ReplayMove = FVector2D(Frame.Move);
+			Look += FVector2D(Frame.Look);
+
+			// A press and release in one recorded frame were a tap; keep them as two edges
+			if (Frame.Buttons & FSkaterInputFrame::JumpPressed)
+			{
+				PendingReplayEdges.Add(FSkaterInputFrame::JumpPressed);
+			}
+
+			if (Frame.Buttons & FSkaterInputFrame::JumpReleased)
+			{
+				PendingReplayEdges.Add(FSkaterInputFrame::JumpReleased);
+			}
+		}
+
+		if (!Frames.IsValidIndex(ReplayFrameIndex))
+		{
+			if (!bLoop)
+			{
+				// Let the last frames reach the skater before the replayed input is cleared
+				ApplyReplayInput(Look, 0);
+				StopReplay();
+				return;
+			}
+
+			ReplayTime = 0.0;
+			ReplayFrameIndex = 0;
+		}
+	}
+
+	// One edge per tick, so a press is seen by movement before its release clears it
+	uint8 Edge = 0;
+	if (PendingReplayEdges.Num() > 0)
+	{
+		Edge = PendingReplayEdges[0];
+		PendingReplayEdges.RemoveAt(0, 1, EAllowShrinking::No);
+	}
+
+	ApplyReplayInput(Look, Edge);
+
+	// Drop time we could not catch up on rather than spiralling
+	if (Steps == MaxReplayStepsPerTick)
+	{
+		ReplayAccumulator = FMath::Min(ReplayAccumulator, ReplayTimestep);
+	}
+}
+
+void USkaterInputRecorderComponent::ApplyReplayInput(const FVector2D& Look, uint8 Edge) const
+{
+	ASkaterCharacterBase* Skater = GetSkater();
+	if (!Skater)
+	{
+		return;
+	}
+
+	Skater->SetMovementInput(ReplayMove);
+
+	if (!Look.IsZero())
+	{
+		Skater->ApplyLookInput(Look);
+	}
+
+	if (Edge == FSkaterInputFrame::JumpPressed)
+	{
+		Skater->Jump();
+	}
+	else if (Edge == FSkaterInputFrame::JumpReleased)
+	{
+		Skater->StopJumping();
+	}
+}
+
+void USkaterInputRecorderComponent::UpdateTickEnabled()
+{
+	SetComponentTickEnabled(bRecording || bReplaying);
+}
+
+ASkaterCharacterBase* USkaterInputRecorderComponent::GetSkater() const
+{
+	return Cast<ASkaterCharacterBase>(GetOwner());
+}
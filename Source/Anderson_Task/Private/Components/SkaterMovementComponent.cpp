@@ -0,0 +1,301 @@
+#include "Components/SkaterMovementComponent.h"
+
+#include "GameFramework/Character.h"
+
+USkaterMovementComponent::USkaterMovementComponent()
+	: bWantsAccelerate(false)
+	, bWantsBrake(false)
+{
+	SetNetworkMoveDataContainer(SkaterMoveDataContainer);
+}
+
+bool USkaterMovementComponent::IsSkating() const
+{
+	return MovementMode == MOVE_Custom && CustomMovementMode == static_cast<uint8>(ESkaterCustomMovementMode::Skate);
+}
+
+bool USkaterMovementComponent::IsMovingOnGround() const
+{
+	return Super::IsMovingOnGround() || IsSkating();
+}
+
+float USkaterMovementComponent::GetMaxSpeed() const
+{
+	return IsSkating() ? MaxWalkSpeed : Super::GetMaxSpeed();
+}
+
+float USkaterMovementComponent::GetMaxBrakingDeceleration() const
+{
+	if (!IsSkating())
+	{
+		return Super::GetMaxBrakingDeceleration();
+	}
+
+	switch (SkateState)
+	{
+	case ESkaterMovementState::Accelerating:
+		return AccelerateDeceleration;
+	case ESkaterMovementState::Braking:
+		return BrakeDeceleration;
+	case ESkaterMovementState::Coasting:
+	default:
+		return CoastDeceleration;
+	}
+}
+
+void USkaterMovementComponent::SetSkateInput(const FVector2D& Input)
+{
+	SteerInput = QuantizeSteerInput(Input.X);
+	bWantsAccelerate = Input.Y > InputDeadzone;
+	bWantsBrake = Input.Y < -InputDeadzone;
+}
+
+void USkaterMovementComponent::SetRequestedSkateState(ESkaterMovementState NewState)
+{
+	bWantsAccelerate = NewState == ESkaterMovementState::Accelerating;
+	bWantsBrake = NewState == ESkaterMovementState::Braking;
+}
+
+void USkaterMovementComponent::OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode)
+{
+	Super::OnMovementModeChanged(PreviousMovementMode, PreviousCustomMode);
+
+	// Landing and default ground modes resolve to walking; skaters skate instead
+	if (bSkateOnGround && MovementMode == MOVE_Walking)
+	{
+		SetMovementMode(MOVE_Custom, static_cast<uint8>(ESkaterCustomMovementMode::Skate));
+	}
+}
+
+void USkaterMovementComponent::PhysCustom(float DeltaTime, int32 Iterations)
+{
+	if (CustomMovementMode == static_cast<uint8>(ESkaterCustomMovementMode::Skate))
+	{
+		PhysSkate(DeltaTime, Iterations);
+		return;
+	}
+
+	Super::PhysCustom(DeltaTime, Iterations);
+}
+
+void USkaterMovementComponent::PhysSkate(float DeltaTime, int32 Iterations)
+{
+	if (DeltaTime < MIN_TICK_TIME)
+	{
+		return;
+	}
+
+	UpdateSkateState();
+
+	// Simulated proxies receive rotation through replication and carry no input
+	if (CharacterOwner && CharacterOwner->GetLocalRole() != ROLE_SimulatedProxy && !bSteeringDrivenExternally)
+	{
+		ApplySteering(DeltaTime);
+	}
+
+	// Ground integration is shared with walking; braking uses GetMaxBrakingDeceleration
+	PhysWalking(DeltaTime, Iterations);
+}
+
+void USkaterMovementComponent::ApplySteering(float DeltaTime)
+{
+	const float TargetTurn = SteerInput / 127.f;
+	CurrentTurnValue = StepTurnValue(CurrentTurnValue, TargetTurn, DeltaTime, SteeringInterpSpeed);
+
+	if (FMath::Abs(CurrentTurnValue) <= TurnDeadzone)
+	{
+		return;
+	}
+
+	ApplyYawDelta(CurrentTurnValue * TurnRate * DeltaTime);
+}
+
+void USkaterMovementComponent::ApplyYawDelta(float YawDelta)
+{
+	if (!UpdatedComponent)
+	{
+		return;
+	}
+
+	const FRotator RotationDelta(0.f, YawDelta, 0.f);
+	const FQuat NewRotation = RotationDelta.Quaternion() * UpdatedComponent->GetComponentQuat();
+
+	MoveUpdatedComponent(FVector::ZeroVector, NewRotation, false);
+	Velocity = RotationDelta.RotateVector(Velocity);
+}
+
+void USkaterMovementComponent::SetSteeringDrivenExternally(bool bExternal)
+{
+	bSteeringDrivenExternally = bExternal;
+}
+
+void USkaterMovementComponent::ApplyExternalSteering(float TurnValue, float YawDelta)
+{
+	CurrentTurnValue = TurnValue;
+
+	if (YawDelta != 0.f)
+	{
+		ApplyYawDelta(YawDelta);
+	}
+}
+
+void USkaterMovementComponent::UpdateSkateState()
+{
+	if (bWantsAccelerate)
+	{
+		SkateState = ESkaterMovementState::Accelerating;
+	}
+	else if (bWantsBrake)
+	{
+		SkateState = ESkaterMovementState::Braking;
+	}
+	else
+	{
+		SkateState = ESkaterMovementState::Coasting;
+	}
+}
+
+void USkaterMovementComponent::UpdateFromCompressedFlags(uint8 Flags)
+{
+	Super::UpdateFromCompressedFlags(Flags);
+
+	bWantsAccelerate = (Flags & FSavedMove_Character::FLAG_Custom_0) != 0;
+	bWantsBrake = (Flags & FSavedMove_Character::FLAG_Custom_1) != 0;
+}
+
+void USkaterMovementComponent::MoveAutonomous(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags,
+	const FVector& NewAccel)
+{
+	// The server reads the steering of the move being replayed before it is simulated
+	if (const FSkaterNetworkMoveData* MoveData = static_cast<const FSkaterNetworkMoveData*>(GetCurrentNetworkMoveData()))
+	{
+		SteerInput = MoveData->SteerInput;
+	}
+
+	Super::MoveAutonomous(ClientTimeStamp, DeltaTime, CompressedFlags, NewAccel);
+}
+
+FNetworkPredictionData_Client* USkaterMovementComponent::GetPredictionData_Client() const
+{
+	if (!ClientPredictionData)
+	{
+		USkaterMovementComponent* MutableThis = const_cast<USkaterMovementComponent*>(this);
+		MutableThis->ClientPredictionData = new FNetworkPredictionData_Client_Skater(*this);
+	}
+
+	return ClientPredictionData;
+}
+
+// FSavedMove_Skater ---------------------------------------------------
+
+FSavedMove_Skater::FSavedMove_Skater()
+	: bSavedAccelerate(false)
+	, bSavedBrake(false)
+{
+}
+
+void FSavedMove_Skater::Clear()
+{
+	Super::Clear();
+
+	bSavedAccelerate = false;
+	bSavedBrake = false;
+	SavedSteerInput = 0;
+	SavedTurnValue = 0.f;
+}
+
+uint8 FSavedMove_Skater::GetCompressedFlags() const
+{
+	uint8 Result = Super::GetCompressedFlags();
+
+	if (bSavedAccelerate)
+	{
+		Result |= FLAG_Custom_0;
+	}
+
+	if (bSavedBrake)
+	{
+		Result |= FLAG_Custom_1;
+	}
+
+	return Result;
+}
+
+bool FSavedMove_Skater::CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const
+{
+	const FSavedMove_Skater* NewSkaterMove = static_cast<const FSavedMove_Skater*>(NewMove.Get());
+
+	if (SavedSteerInput != NewSkaterMove->SavedSteerInput ||
+		bSavedAccelerate != NewSkaterMove->bSavedAccelerate ||
+		bSavedBrake != NewSkaterMove->bSavedBrake)
+	{
+		return false;
+	}
+
+	return Super::CanCombineWith(NewMove, InCharacter, MaxDelta);
+}
+
+void FSavedMove_Skater::SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel,
+	FNetworkPredictionData_Client_Character& ClientData)
+{
+	Super::SetMoveFor(C, InDeltaTime, NewAccel, ClientData);
+
+	if (const USkaterMovementComponent* Movement = Cast<USkaterMovementComponent>(C->GetCharacterMovement()))
+	{
+		SavedSteerInput = Movement->SteerInput;
+		bSavedAccelerate = Movement->bWantsAccelerate;
+		bSavedBrake = Movement->bWantsBrake;
+		SavedTurnValue = Movement->CurrentTurnValue;
+	}
+}
+
+void FSavedMove_Skater::PrepMoveFor(ACharacter* C)
+{
+	Super::PrepMoveFor(C);
+
+	if (USkaterMovementComponent* Movement = Cast<USkaterMovementComponent>(C->GetCharacterMovement()))
+	{
+		Movement->SteerInput = SavedSteerInput;
+		Movement->bWantsAccelerate = bSavedAccelerate;
+		Movement->bWantsBrake = bSavedBrake;
+		Movement->CurrentTurnValue = SavedTurnValue;
+	}
+}
+
+// FSkaterNetworkMoveData ----------------------------------------------
+
+void FSkaterNetworkMoveData::ClientFillNetworkMoveData(const FSavedMove_Character& ClientMove, ENetworkMoveType MoveType)
+{
+	Super::ClientFillNetworkMoveData(ClientMove, MoveType);
+
+	SteerInput = static_cast<const FSavedMove_Skater&>(ClientMove).SavedSteerInput;
+}
+
+bool FSkaterNetworkMoveData::Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar,
+	UPackageMap* PackageMap, ENetworkMoveType MoveType)
+{
+	Super::Serialize(CharacterMovement, Ar, PackageMap, MoveType);
+
+	Ar << SteerInput;
+
+	return !Ar.IsError();
+}
+
+FSkaterNetworkMoveDataContainer::FSkaterNetworkMoveDataContainer()
+{
+	NewMoveData = &SkaterDefaultMoveData[0];
+	PendingMoveData = &SkaterDefaultMoveData[1];
+	OldMoveData = &SkaterDefaultMoveData[2];
+}
+
+// FNetworkPredictionData_Client_Skater --------------------------------
+
+FNetworkPredictionData_Client_Skater::FNetworkPredictionData_Client_Skater(const UCharacterMovementComponent& ClientMovement)
+	: Super(ClientMovement)
+{
+}
+
+FSavedMovePtr FNetworkPredictionData_Client_Skater::AllocateNewMove()
+{
+	return FSavedMovePtr(new FSavedMove_Skater());
+}
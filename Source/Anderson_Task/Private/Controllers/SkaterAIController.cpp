@@ -0,0 +1,187 @@
+#include "Controllers/SkaterAIController.h"
+
+#include "Characters/SkaterAICharacter.h"
+#include "Components/SplineComponent.h"
+#include "NavigationPath.h"
+#include "NavigationSystem.h"
+#include "Subsystems/ArtifactRegistrySubsystem.h"
+
+DEFINE_LOG_CATEGORY(LogSkaterAI);
+
+ASkaterAIController::ASkaterAIController()
+{
+	bWantsPlayerState = true;
+	PrimaryActorTick.bCanEverTick = true;
+}
+
+void ASkaterAIController::OnPossess(APawn* InPawn)
+{
+	Super::OnPossess(InPawn);
+
+	// Spread decisions of bots spawned on the same frame
+	DecisionAccumulator = FMath::FRandRange(0.f, DecisionInterval);
+
+	if (const ASkaterAICharacter* Bot = Cast<ASkaterAICharacter>(InPawn))
+	{
+		SetRoute(Bot->GetRouteSpline());
+	}
+
+	if (ASkaterCharacterBase* Skater = Cast<ASkaterCharacterBase>(InPawn))
+	{
+		Skater->SetUseBatchedMovement(bUseBatchedMovement);
+	}
+}
+
+void ASkaterAIController::OnUnPossess()
+{
+	if (ASkaterCharacterBase* Skater = Cast<ASkaterCharacterBase>(GetPawn()))
+	{
+		Skater->SetMovementInput(FVector2D::ZeroVector);
+	}
+
+	TargetArtifact.Reset();
+	PathPoints.Reset();
+
+	Super::OnUnPossess();
+}
+
+void ASkaterAIController::SetRoute(USplineComponent* InRoute)
+{
+	Route = InRoute;
+}
+
+void ASkaterAIController::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	ASkaterCharacterBase* Skater = Cast<ASkaterCharacterBase>(GetPawn());
+	if (!Skater)
+	{
+		return;
+	}
+
+	DecisionAccumulator += DeltaTime;
+	if (DecisionAccumulator >= DecisionInterval)
+	{
+		DecisionAccumulator = 0.f;
+		UpdateGoal();
+	}
+
+	FVector Goal;
+	Skater->SetMovementInput(GetSteeringGoal(Goal) ? ComputeInput(Skater, Goal) : FVector2D::ZeroVector);
+}
+
+void ASkaterAIController::UpdateGoal()
+{
+	const APawn* MyPawn = GetPawn();
+	const UArtifactRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UArtifactRegistrySubsystem>();
+
+	FVector TargetLocation;
+	AActor* Nearest = Registry
+		? Registry->FindNearestArtifact(MyPawn->GetActorLocation(), ArtifactSearchRadius, TargetLocation)
+		: nullptr;
+
+	if (!Nearest)
+	{
+		TargetArtifact.Reset();
+		PathPoints.Reset();
+		return;
+	}
+
+	// Only repath when the target changes; paths are the expensive part of a decision. A pooled
+	// artifact recycled elsewhere keeps its pointer, so its location is compared too
+	if (Nearest != TargetArtifact.Get() || !TargetLocation.Equals(TargetArtifactLocation, AcceptanceRadius))
+	{
+		TargetArtifact = Nearest;
+		TargetArtifactLocation = TargetLocation;
+		BuildPathTo(TargetLocation);
+	}
+}
+
+void ASkaterAIController::BuildPathTo(const FVector& TargetLocation)
+{
+	PathPoints.Reset();
+	PathIndex = 0;
+
+	if (bUseNavigation)
+	{
+		if (const UNavigationPath* Path = UNavigationSystemV1::FindPathToLocationSynchronously(this,
+			GetPawn()->GetActorLocation(), TargetLocation, GetPawn()))
+		{
+			if (Path->IsValid() && Path->PathPoints.Num() > 1)
+			{
+				// The first point is the start location
+				PathPoints.Append(Path->PathPoints.GetData() + 1, Path->PathPoints.Num() - 1);
+			}
+		}
+	}
+
+	// Straight line when there is no navmesh or no path
+	if (PathPoints.IsEmpty())
+	{
+		PathPoints.Add(TargetLocation);
+	}
+}
+
+bool ASkaterAIController::GetSteeringGoal(FVector& OutGoal)
+{
+	const FVector Location = GetPawn()->GetActorLocation();
+
+	if (TargetArtifact.IsValid())
+	{
+		// Skip reached points; the artifact itself is collected by driving through it
+		while (PathIndex < PathPoints.Num() - 1 &&
+			FVector::DistSquared2D(Location, PathPoints[PathIndex]) <= FMath::Square(AcceptanceRadius))
+		{
+			++PathIndex;
+		}
+
+		if (PathPoints.IsValidIndex(PathIndex))
+		{
+			OutGoal = PathPoints[PathIndex];
+			return true;
+		}
+	}
+
+	const USplineComponent* Spline = Route.Get();
+	if (!Spline)
+	{
+		return false;
+	}
+
+	const float Key = Spline->FindInputKeyClosestToWorldLocation(Location);
+	const float SplineLength = Spline->GetSplineLength();
+	float Distance = Spline->GetDistanceAlongSplineAtSplineInputKey(Key) + LookAheadDistance;
+
+	if (Spline->IsClosedLoop())
+	{
+		Distance = FMath::Fmod(Distance, SplineLength);
+	}
+	else
+	{
+		Distance = FMath::Min(Distance, SplineLength);
+	}
+
+	OutGoal = Spline->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+	return true;
+}
+
+FVector2D ASkaterAIController::ComputeInput(const ASkaterCharacterBase* Skater, const FVector& Goal) const
+{
+	const FVector ToGoal = (Goal - Skater->GetActorLocation()).GetSafeNormal2D();
+	if (ToGoal.IsNearlyZero())
+	{
+		return FVector2D::ZeroVector;
+	}
+
+	const FVector Forward = Skater->GetActorForwardVector().GetSafeNormal2D();
+
+	// Positive angles are to the right (Z-up, left-handed)
+	const float Angle = FMath::RadiansToDegrees(FMath::Atan2(
+		FVector::CrossProduct(Forward, ToGoal).Z, FVector::DotProduct(Forward, ToGoal)));
+
+	const float Steering = FMath::Clamp(Angle / FullSteeringAngle, -1.f, 1.f);
+	const float Throttle = FMath::Abs(Angle) > CoastAngle ? 0.f : 1.f;
+
+	return FVector2D(Steering, Throttle);
+}
@@ -1,9 +1,11 @@
 #include "GameModes/SkaterGameMode.h"
+#include "GameStates/SkaterGameState.h"
+#include "Subsystems/SkaterTelemetrySubsystem.h"
 #include "UObject/ConstructorHelpers.h"
 
 ASkaterGameMode::ASkaterGameMode()
 {
-
+	GameStateClass = ASkaterGameState::StaticClass();
 }
 
 void ASkaterGameMode::PostInitProperties()
@@ -19,4 +21,25 @@ void ASkaterGameMode::PostInitProperties()
 	{
 		PlayerControllerClass = DefaultPlayerControllerClass;
 	}
-}
\ No newline at end of file
+}
+
+void ASkaterGameMode::StartPlay()
+{
+	Super::StartPlay();
+
+	if (USkaterTelemetrySubsystem* Telemetry = GetWorld()->GetSubsystem<USkaterTelemetrySubsystem>())
+	{
+		const FString MapName = UWorld::RemovePIEPrefix(GetWorld()->GetMapName());
+		Telemetry->BeginSession(FString::Printf(TEXT("%s_%s"), *MapName, *FDateTime::Now().ToString()));
+	}
+}
+
+void ASkaterGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (USkaterTelemetrySubsystem* Telemetry = GetWorld()->GetSubsystem<USkaterTelemetrySubsystem>())
+	{
+		Telemetry->EndSession();
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
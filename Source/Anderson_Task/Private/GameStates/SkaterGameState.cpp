@@ -0,0 +1,228 @@
+#include "GameStates/SkaterGameState.h"
+
+#include "Algo/BinarySearch.h"
+#include "Net/UnrealNetwork.h"
+#include "PlayerStates/SkaterPlayerState.h"
+
+void FSkaterRankList::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+	if (Owner)
+	{
+		Owner->HandleRankListReplicated();
+	}
+}
+
+ASkaterGameState::ASkaterGameState()
+{
+	RankList.Owner = this;
+}
+
+void ASkaterGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(ASkaterGameState, RankList);
+}
+
+void ASkaterGameState::AddPlayerState(APlayerState* PlayerState)
+{
+	Super::AddPlayerState(PlayerState);
+
+	ASkaterPlayerState* SkaterPlayerState = Cast<ASkaterPlayerState>(PlayerState);
+	if (!HasAuthority() || !SkaterPlayerState || ItemIndices.Contains(PlayerState))
+	{
+		return;
+	}
+
+	FSkaterRankItem& Item = RankList.Items.AddDefaulted_GetRef();
+	Item.PlayerState = SkaterPlayerState;
+	Item.Points = SkaterPlayerState->GetPoints_Implementation();
+	Item.JoinOrder = NextJoinOrder++;
+
+	const int32 ItemIndex = RankList.Items.Num() - 1;
+	ItemIndices.Add(PlayerState, ItemIndex);
+
+	// Everyone from the new position down moves one rank
+	RefreshRanks(InsertRanked(ItemIndex), RankedItems.Num() - 1);
+
+	SkaterPlayerState->OnPointsChangedNative.AddUObject(this, &ASkaterGameState::HandlePointsChanged);
+	OnLeaderboardChanged.Broadcast();
+}
+
+void ASkaterGameState::RemovePlayerState(APlayerState* PlayerState)
+{
+	Super::RemovePlayerState(PlayerState);
+
+	const int32* Found = HasAuthority() ? ItemIndices.Find(PlayerState) : nullptr;
+	if (!Found)
+	{
+		return;
+	}
+
+	const int32 ItemIndex = *Found;
+	const int32 Position = FindRankedPosition(ItemIndex);
+	RankedItems.RemoveAt(Position, 1, EAllowShrinking::No);
+	ItemIndices.Remove(PlayerState);
+
+	// The last item moves into the freed slot
+	const int32 LastIndex = RankList.Items.Num() - 1;
+	if (ItemIndex != LastIndex)
+	{
+		RankedItems[FindRankedPosition(LastIndex)] = ItemIndex;
+		ItemIndices.Add(RankList.Items[LastIndex].PlayerState.Get(), ItemIndex);
+	}
+
+	RankList.Items.RemoveAtSwap(ItemIndex, 1, EAllowShrinking::No);
+	RankList.MarkArrayDirty();
+
+	RefreshRanks(Position, RankedItems.Num() - 1);
+
+	if (ASkaterPlayerState* SkaterPlayerState = Cast<ASkaterPlayerState>(PlayerState))
+	{
+		SkaterPlayerState->OnPointsChangedNative.RemoveAll(this);
+	}
+
+	OnLeaderboardChanged.Broadcast();
+}
+
+void ASkaterGameState::HandlePointsChanged(ASkaterPlayerState* PlayerState, int32 OldPoints, int32 NewPoints)
+{
+	const int32* Found = ItemIndices.Find(PlayerState);
+	if (!Found)
+	{
+		return;
+	}
+
+	const int32 ItemIndex = *Found;
+	const int32 OldPosition = FindRankedPosition(ItemIndex);
+	RankedItems.RemoveAt(OldPosition, 1, EAllowShrinking::No);
+
+	FSkaterRankItem& Item = RankList.Items[ItemIndex];
+	Item.Points = NewPoints;
+	RankList.MarkItemDirty(Item);
+
+	// Only the players between the old and new position change rank
+	const int32 NewPosition = InsertRanked(ItemIndex);
+	RefreshRanks(FMath::Min(OldPosition, NewPosition), FMath::Max(OldPosition, NewPosition));
+
+	OnLeaderboardChanged.Broadcast();
+}
+
+void ASkaterGameState::HandleRankListReplicated()
+{
+	const int32 NumItems = RankList.Items.Num();
+
+	// Ranks are unique and dense, so the order is rebuilt without sorting
+	RankedItems.Init(INDEX_NONE, NumItems);
+	ItemIndices.Reset();
+
+	for (int32 ItemIndex = 0; ItemIndex < NumItems; ++ItemIndex)
+	{
+		const FSkaterRankItem& Item = RankList.Items[ItemIndex];
+		if (Item.Rank >= 1 && Item.Rank <= NumItems && Item.PlayerState)
+		{
+			RankedItems[Item.Rank - 1] = ItemIndex;
+			ItemIndices.Add(Item.PlayerState.Get(), ItemIndex);
+		}
+	}
+
+	// Rows still waiting for their rank update
+	RankedItems.Remove(INDEX_NONE);
+
+	OnLeaderboardChanged.Broadcast();
+}
+
+bool ASkaterGameState::RanksAhead(int32 ItemA, int32 ItemB) const
+{
+	const FSkaterRankItem& A = RankList.Items[ItemA];
+	const FSkaterRankItem& B = RankList.Items[ItemB];
+
+	return A.Points != B.Points ? A.Points > B.Points : A.JoinOrder < B.JoinOrder;
+}
+
+int32 ASkaterGameState::FindRankedPosition(int32 ItemIndex) const
+{
+	// Keys are unique, so the lower bound of the item's own key is its position
+	return Algo::LowerBound(RankedItems, ItemIndex, [this](int32 A, int32 B) { return RanksAhead(A, B); });
+}
+
+int32 ASkaterGameState::InsertRanked(int32 ItemIndex)
+{
+	const int32 Position = FindRankedPosition(ItemIndex);
+	RankedItems.Insert(ItemIndex, Position);
+	return Position;
+}
+
+void ASkaterGameState::RefreshRanks(int32 First, int32 Last)
+{
+	for (int32 Position = First; Position <= Last; ++Position)
+	{
+		FSkaterRankItem& Item = RankList.Items[RankedItems[Position]];
+		if (Item.Rank != Position + 1)
+		{
+			Item.Rank = Position + 1;
+			RankList.MarkItemDirty(Item);
+		}
+	}
+}
+
+FSkaterLeaderboardRow ASkaterGameState::MakeRow(int32 Position) const
+{
+	const FSkaterRankItem& Item = RankList.Items[RankedItems[Position]];
+
+	FSkaterLeaderboardRow Row;
+	Row.PlayerState = Item.PlayerState;
+	// The replicated rank; a client's order can have gaps while the list is still arriving
+	Row.Rank = Item.Rank;
+	Row.Points = Item.Points;
+	return Row;
+}
+
+TArray<FSkaterLeaderboardRow> ASkaterGameState::GetTopEntries(int32 Count) const
+{
+	const int32 NumRows = FMath::Clamp(Count, 0, RankedItems.Num());
+
+	TArray<FSkaterLeaderboardRow> Rows;
+	Rows.Reserve(NumRows);
+	for (int32 Position = 0; Position < NumRows; ++Position)
+	{
+		Rows.Add(MakeRow(Position));
+	}
+
+	return Rows;
+}
+
+TArray<FSkaterLeaderboardRow> ASkaterGameState::GetNeighbourhood(const APlayerState* PlayerState, int32 Radius) const
+{
+	TArray<FSkaterLeaderboardRow> Rows;
+
+	const int32 Rank = GetRank(PlayerState);
+	if (Rank == 0)
+	{
+		return Rows;
+	}
+
+	const int32 First = FMath::Max(0, Rank - 1 - Radius);
+	const int32 Last = FMath::Min(RankedItems.Num() - 1, Rank - 1 + Radius);
+
+	Rows.Reserve(Last - First + 1);
+	for (int32 Position = First; Position <= Last; ++Position)
+	{
+		Rows.Add(MakeRow(Position));
+	}
+
+	return Rows;
+}
+
+int32 ASkaterGameState::GetRank(const APlayerState* PlayerState) const
+{
+	const int32* Found = ItemIndices.Find(PlayerState);
+	if (!Found)
+	{
+		return 0;
+	}
+
+	// Clients read the replicated rank; the server's ranks are always current
+	const int32 Rank = RankList.Items[*Found].Rank;
+	return Rank >= 1 && Rank <= RankList.Items.Num() ? Rank : 0;
+}
@@ -0,0 +1,182 @@
+#include "Networking/SkaterReplicationGraph.h"
+
+#include "Characters/SkaterCharacterBase.h"
+#include "Collectables/Artifacts/PointArtifact.h"
+#include "Collectables/Replication/ArtifactCollectionManager.h"
+#include "Engine/LevelScriptActor.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "ReplicationGraphTypes.h"
+#include "UObject/UObjectIterator.h"
+
+DEFINE_LOG_CATEGORY(LogSkaterReplicationGraph);
+
+void USkaterReplicationGraph::InitGlobalActorClassSettings()
+{
+	Super::InitGlobalActorClassSettings();
+
+	// Explicit routing; anything else is derived from its class defaults on first use
+	ClassRepNodePolicies.Set(AGameStateBase::StaticClass(), ESkaterRepNodeMapping::RelevantAllConnections);
+	ClassRepNodePolicies.Set(AArtifactCollectionManager::StaticClass(), ESkaterRepNodeMapping::RelevantAllConnections);
+	ClassRepNodePolicies.Set(APlayerState::StaticClass(), ESkaterRepNodeMapping::NotRouted);
+	ClassRepNodePolicies.Set(APlayerController::StaticClass(), ESkaterRepNodeMapping::NotRouted);
+	ClassRepNodePolicies.Set(ALevelScriptActor::StaticClass(), ESkaterRepNodeMapping::NotRouted);
+	ClassRepNodePolicies.Set(ASkaterCharacterBase::StaticClass(), ESkaterRepNodeMapping::Spatialize_Dynamic);
+	ClassRepNodePolicies.Set(APointArtifact::StaticClass(), ESkaterRepNodeMapping::Spatialize_Dormancy);
+
+	// Every replicated class needs replication info before its first actor is added
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		UClass* Class = *It;
+		const AActor* ActorCDO = Cast<AActor>(Class->GetDefaultObject(false));
+		if (!ActorCDO || !ActorCDO->GetIsReplicated() || Class->HasAnyClassFlags(CLASS_Abstract))
+		{
+			continue;
+		}
+
+		// Skip skeleton and reinstanced Blueprint classes
+		if (Class->GetName().StartsWith(TEXT("SKEL_")) || Class->GetName().StartsWith(TEXT("REINST_")))
+		{
+			continue;
+		}
+
+		float CullDistance = FMath::Sqrt(ActorCDO->GetNetCullDistanceSquared());
+		if (Class->IsChildOf(ASkaterCharacterBase::StaticClass()))
+		{
+			CullDistance = SkaterCullDistance;
+		}
+		else if (Class->IsChildOf(APointArtifact::StaticClass()))
+		{
+			CullDistance = ArtifactCullDistance;
+		}
+
+		const ESkaterRepNodeMapping Policy = GetMappingPolicy(Class);
+		const bool bSpatialized = Policy == ESkaterRepNodeMapping::Spatialize_Static
+			|| Policy == ESkaterRepNodeMapping::Spatialize_Dynamic
+			|| Policy == ESkaterRepNodeMapping::Spatialize_Dormancy;
+
+		InitClassReplicationInfo(Class, bSpatialized ? CullDistance : 0.f);
+	}
+}
+
+void USkaterReplicationGraph::InitGlobalGraphNodes()
+{
+	GridNode = CreateNewNode<UReplicationGraphNode_GridSpatialization2D>();
+	GridNode->CellSize = GridCellSize;
+	GridNode->SpatialBias = SpatialBias;
+
+	if (bEnableDynamicSpatialFrequency)
+	{
+		// Cells replicate their dynamic actors at a rate falling off with distance from the viewer
+		GridNode->CreateCellNodeOverride = [](UReplicationGraphNode_GridCell* NewCell)
+		{
+			NewCell->CreateDynamicNodeOverride = [](UReplicationGraphNode_GridCell* Parent)
+			{
+				return Parent->CreateChildNode<UReplicationGraphNode_DynamicSpatialFrequency>();
+			};
+		};
+	}
+
+	AddGlobalGraphNode(GridNode);
+
+	AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+	AddGlobalGraphNode(AlwaysRelevantNode);
+
+	// Gathers every player state itself and spreads them over frames
+	PlayerStateNode = CreateNewNode<UReplicationGraphNode_PlayerStateFrequencyLimiter>();
+	AddGlobalGraphNode(PlayerStateNode);
+}
+
+void USkaterReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection)
+{
+	Super::InitConnectionGraphNodes(RepGraphConnection);
+
+	// The connection's controller, pawn and view target
+	UReplicationGraphNode_AlwaysRelevant_ForConnection* ConnectionNode = CreateNewNode<UReplicationGraphNode_AlwaysRelevant_ForConnection>();
+	AddConnectionGraphNode(ConnectionNode, RepGraphConnection);
+}
+
+void USkaterReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo,
+	FGlobalActorReplicationInfo& GlobalInfo)
+{
+	switch (GetMappingPolicy(ActorInfo.Class))
+	{
+	case ESkaterRepNodeMapping::RelevantAllConnections:
+		AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+		break;
+	case ESkaterRepNodeMapping::Spatialize_Static:
+		GridNode->AddActor_Static(ActorInfo, GlobalInfo);
+		break;
+	case ESkaterRepNodeMapping::Spatialize_Dynamic:
+		GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+		break;
+	case ESkaterRepNodeMapping::Spatialize_Dormancy:
+		GridNode->AddActor_Dormancy(ActorInfo, GlobalInfo);
+		break;
+	default:
+		break;
+	}
+}
+
+void USkaterReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+	switch (GetMappingPolicy(ActorInfo.Class))
+	{
+	case ESkaterRepNodeMapping::RelevantAllConnections:
+		AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+		break;
+	case ESkaterRepNodeMapping::Spatialize_Static:
+		GridNode->RemoveActor_Static(ActorInfo);
+		break;
+	case ESkaterRepNodeMapping::Spatialize_Dynamic:
+		GridNode->RemoveActor_Dynamic(ActorInfo);
+		break;
+	case ESkaterRepNodeMapping::Spatialize_Dormancy:
+		GridNode->RemoveActor_Dormancy(ActorInfo);
+		break;
+	default:
+		break;
+	}
+}
+
+ESkaterRepNodeMapping USkaterReplicationGraph::GetMappingPolicy(const UClass* Class)
+{
+	if (const ESkaterRepNodeMapping* Policy = ClassRepNodePolicies.Get(Class))
+	{
+		return *Policy;
+	}
+
+	const AActor* ActorCDO = CastChecked<AActor>(Class->GetDefaultObject());
+
+	ESkaterRepNodeMapping Policy = ESkaterRepNodeMapping::Spatialize_Static;
+	if (ActorCDO->bOnlyRelevantToOwner)
+	{
+		Policy = ESkaterRepNodeMapping::NotRouted;
+	}
+	else if (ActorCDO->bAlwaysRelevant)
+	{
+		Policy = ESkaterRepNodeMapping::RelevantAllConnections;
+	}
+	else if (ActorCDO->IsReplicatingMovement())
+	{
+		Policy = ESkaterRepNodeMapping::Spatialize_Dynamic;
+	}
+
+	ClassRepNodePolicies.Set(Class, Policy);
+	return Policy;
+}
+
+void USkaterReplicationGraph::InitClassReplicationInfo(UClass* Class, float CullDistance)
+{
+	const AActor* ActorCDO = CastChecked<AActor>(Class->GetDefaultObject());
+
+	FClassReplicationInfo ClassInfo;
+	ClassInfo.SetCullDistanceSquared(FMath::Square(CullDistance));
+	ClassInfo.ReplicationPeriodFrame = GetReplicationPeriodFrameForFrequency(ActorCDO->GetNetUpdateFrequency());
+
+	GlobalActorReplicationInfoMap.SetClassInfo(Class, ClassInfo);
+
+	UE_LOG(LogSkaterReplicationGraph, Verbose, TEXT("%s: cull %.0f, period %d frames"), *Class->GetName(),
+		CullDistance, ClassInfo.ReplicationPeriodFrame);
+}
@@ -1,5 +1,9 @@
 #include "PlayerStates/SkaterPlayerState.h"
+#include "Misc/CoreDelegates.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "Net/UnrealNetwork.h"
+#include "Profiling/SkaterTrace.h"
+#include "Subsystems/SkaterTelemetrySubsystem.h"
 
 ASkaterPlayerState::ASkaterPlayerState()
 {
@@ -10,38 +14,129 @@ void ASkaterPlayerState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& O
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME(ASkaterPlayerState, CurrentPoints);
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASkaterPlayerState, CurrentPoints, Params);
+}
+
+void ASkaterPlayerState::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	CommitPendingPoints();
+
+	Super::EndPlay(EndPlayReason);
 }
 
 int32 ASkaterPlayerState::AddPoints_Implementation(int32 Points)
+{
+	return AddPointsWithSource(Points, NAME_None);
+}
+
+int32 ASkaterPlayerState::AddPointsWithSource(int32 Points, FName SourceId)
 {
 	// Only the server should modify points
 	if (!HasAuthority())
 		return CurrentPoints;
 
+	if (!bHasPendingPoints)
+	{
+		PendingPoints = CurrentPoints;
+		bHasPendingPoints = true;
+	}
+
+	const int32 OldPoints = PendingPoints;
+	PendingPoints = FMath::Max(0, PendingPoints + Points);
+	RecordScoreEvent(PendingPoints - OldPoints, SourceId);
+
+	// One commit per frame however many pickups land in it
+	if (!EndFrameHandle.IsValid())
+	{
+		EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &ASkaterPlayerState::CommitPendingPoints);
+	}
+
+	return PendingPoints;
+}
+
+void ASkaterPlayerState::CommitPendingPoints()
+{
+	if (EndFrameHandle.IsValid())
+	{
+		FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+		EndFrameHandle.Reset();
+	}
+
+	if (!bHasPendingPoints)
+		return;
+
+	bHasPendingPoints = false;
+	if (PendingPoints == CurrentPoints)
+		return;
+
 	const int32 OldPoints = CurrentPoints;
-	CurrentPoints = FMath::Max(0, CurrentPoints + Points);
+	CurrentPoints = PendingPoints;
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASkaterPlayerState, CurrentPoints, this);
+	SKATER_TRACE_SCORE(this, OldPoints, CurrentPoints);
+
+	BroadcastPointsChanged(OldPoints);
+}
 
+void ASkaterPlayerState::BroadcastPointsChanged(int32 OldPoints)
+{
 	OnPointsChanged.Broadcast(OldPoints, CurrentPoints, CurrentPoints - OldPoints);
-	return CurrentPoints;
+	OnPointsChangedNative.Broadcast(this, OldPoints, CurrentPoints);
+
+	if (USkaterTelemetrySubsystem* Telemetry = GetWorld() ? GetWorld()->GetSubsystem<USkaterTelemetrySubsystem>() : nullptr)
+		Telemetry->RecordPointsBroadcast();
+}
+
+void ASkaterPlayerState::RecordScoreEvent(int32 Delta, FName SourceId)
+{
+	if (ScoreHistory.Num() != MaxScoreHistory)
+	{
+		ScoreHistory.SetNum(FMath::Max(1, MaxScoreHistory));
+		ScoreHistoryHead = 0;
+		ScoreHistoryCount = 0;
+	}
+
+	FSkaterScoreEvent& Event = ScoreHistory[ScoreHistoryHead];
+	Event.SourceId = SourceId;
+	Event.Delta = Delta;
+	Event.Timestamp = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+
+	ScoreHistoryHead = (ScoreHistoryHead + 1) % ScoreHistory.Num();
+	ScoreHistoryCount = FMath::Min(ScoreHistoryCount + 1, ScoreHistory.Num());
+}
+
+TArray<FSkaterScoreEvent> ASkaterPlayerState::GetRecentScoreEvents() const
+{
+	TArray<FSkaterScoreEvent> Events;
+	Events.Reserve(ScoreHistoryCount);
+
+	const int32 First = ScoreHistoryHead - ScoreHistoryCount + ScoreHistory.Num();
+	for (int32 i = 0; i < ScoreHistoryCount; ++i)
+	{
+		Events.Add(ScoreHistory[(First + i) % ScoreHistory.Num()]);
+	}
+
+	return Events;
 }
 
 int32 ASkaterPlayerState::GetPoints_Implementation() const
 {
-	return CurrentPoints;
+	return bHasPendingPoints ? PendingPoints : CurrentPoints;
 }
 
 void ASkaterPlayerState::ResetPoints_Implementation()
 {
-	AddPoints(-CurrentPoints);
+	AddPoints(-GetPoints_Implementation());
 }
 
 bool ASkaterPlayerState::CanAffordPoints_Implementation(int32 Points) const
 {
-	return (CurrentPoints - Points) >= 0;
+	return (GetPoints_Implementation() - Points) >= 0;
 }
 
 void ASkaterPlayerState::OnRep_CurrentPoints(int32 OldPoints)
 {
-    OnPointsChanged.Broadcast(OldPoints, CurrentPoints, CurrentPoints - OldPoints);
+    BroadcastPointsChanged(OldPoints);
 }
@@ -0,0 +1,4 @@
+#include "Profiling/SkaterCsvProfiler.h"
+
+CSV_DEFINE_CATEGORY_MODULE(ANDERSON_TASK_API, Skater, true);
+CSV_DEFINE_CATEGORY_MODULE(ANDERSON_TASK_API, SkaterArtifacts, true);
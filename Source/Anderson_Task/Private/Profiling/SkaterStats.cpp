@@ -0,0 +1,7 @@
+#include "Profiling/SkaterStats.h"
+
+DEFINE_STAT(STAT_SkaterTick);
+DEFINE_STAT(STAT_SkaterBatchedSteering);
+DEFINE_STAT(STAT_ArtifactCollected);
+DEFINE_STAT(STAT_CollectionFeedback);
+DEFINE_STAT(STAT_SkaterHUDTick);
@@ -0,0 +1,74 @@
+#include "Profiling/SkaterTrace.h"
+
+#if SKATER_TRACE_ENABLED
+
+#include "HAL/PlatformTime.h"
+
+UE_TRACE_CHANNEL_DEFINE(SkaterChannel);
+
+UE_TRACE_EVENT_BEGIN(Skater, ArtifactCollected)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, ArtifactId)
+	UE_TRACE_EVENT_FIELD(uint32, CollectorId)
+	UE_TRACE_EVENT_FIELD(int32, Points)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, ArtifactName)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Skater, ScoreChanged)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, PlayerStateId)
+	UE_TRACE_EVENT_FIELD(int32, OldPoints)
+	UE_TRACE_EVENT_FIELD(int32, NewPoints)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Skater, MovementStateChanged)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, SkaterId)
+	UE_TRACE_EVENT_FIELD(uint8, OldState)
+	UE_TRACE_EVENT_FIELD(uint8, NewState)
+UE_TRACE_EVENT_END()
+
+namespace SkaterTrace
+{
+	uint32 GetObjectId(const UObject* Object)
+	{
+		return Object ? Object->GetUniqueID() : 0;
+	}
+}
+
+void FSkaterTrace::OutputCollection(const UObject* Artifact, const UObject* Collector, int32 Points)
+{
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(SkaterChannel))
+	{
+		return;
+	}
+
+	const FString ArtifactName = GetNameSafe(Artifact);
+
+	UE_TRACE_LOG(Skater, ArtifactCollected, SkaterChannel)
+		<< ArtifactCollected.Cycle(FPlatformTime::Cycles64())
+		<< ArtifactCollected.ArtifactId(SkaterTrace::GetObjectId(Artifact))
+		<< ArtifactCollected.CollectorId(SkaterTrace::GetObjectId(Collector))
+		<< ArtifactCollected.Points(Points)
+		<< ArtifactCollected.ArtifactName(*ArtifactName, ArtifactName.Len());
+}
+
+void FSkaterTrace::OutputScore(const UObject* PlayerState, int32 OldPoints, int32 NewPoints)
+{
+	UE_TRACE_LOG(Skater, ScoreChanged, SkaterChannel)
+		<< ScoreChanged.Cycle(FPlatformTime::Cycles64())
+		<< ScoreChanged.PlayerStateId(SkaterTrace::GetObjectId(PlayerState))
+		<< ScoreChanged.OldPoints(OldPoints)
+		<< ScoreChanged.NewPoints(NewPoints);
+}
+
+void FSkaterTrace::OutputMovementState(const UObject* SkaterObject, uint8 OldState, uint8 NewState)
+{
+	UE_TRACE_LOG(Skater, MovementStateChanged, SkaterChannel)
+		<< MovementStateChanged.Cycle(FPlatformTime::Cycles64())
+		<< MovementStateChanged.SkaterId(SkaterTrace::GetObjectId(SkaterObject))
+		<< MovementStateChanged.OldState(OldState)
+		<< MovementStateChanged.NewState(NewState);
+}
+
+#endif
@@ -0,0 +1,283 @@
+#include "Subsystems/ArtifactCollectionSubsystem.h"
+
+#include "Algo/BinarySearch.h"
+#include "Collectables/Artifacts/PointArtifact.h"
+#include "Collectables/Replication/ArtifactCollectionManager.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+
+DEFINE_LOG_CATEGORY(LogArtifactCollection);
+
+namespace ArtifactCollection
+{
+	bool NameLess(FName A, FName B)
+	{
+		// Lexical order is identical on every machine, unlike FName index order
+		return A.LexicalLess(B);
+	}
+}
+
+void UArtifactCollectionSubsystem::Deinitialize()
+{
+	LevelTables.Reset();
+	ArtifactsByIndex.Reset();
+	AppliedBits.Reset();
+	Manager = nullptr;
+
+	Super::Deinitialize();
+}
+
+bool UArtifactCollectionSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+int32 UArtifactCollectionSubsystem::RegisterArtifact(APointArtifact* Artifact)
+{
+	if (!Artifact)
+	{
+		return INDEX_NONE;
+	}
+
+	FLevelTable* Table = FindOrBuildLevelTable(Artifact->GetLevel());
+	const int32 LocalIndex = Table ? FindLocalIndex(*Table, Artifact) : INDEX_NONE;
+	if (LocalIndex == INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+
+	if (!Table->Artifacts[LocalIndex].IsValid())
+	{
+		++Table->NumRegistered;
+	}
+	Table->Artifacts[LocalIndex] = Artifact;
+
+	if (Table->FirstIndex == INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Index = Table->FirstIndex + LocalIndex;
+	if (IsAuthority())
+	{
+		return Index;
+	}
+
+	// Block already mapped; bring the late artifact up to date
+	ArtifactsByIndex[Index] = Artifact;
+	Artifact->ApplyReplicatedCollection(Manager->IsCollected(Index), false);
+	return INDEX_NONE;
+}
+
+void UArtifactCollectionSubsystem::UnregisterArtifact(APointArtifact* Artifact)
+{
+	if (!Artifact)
+	{
+		return;
+	}
+
+	const TObjectKey<ULevel> LevelKey(Artifact->GetLevel());
+	FLevelTable* Table = LevelTables.Find(LevelKey);
+	const int32 LocalIndex = Table ? FindLocalIndex(*Table, Artifact) : INDEX_NONE;
+	if (LocalIndex == INDEX_NONE || Table->Artifacts[LocalIndex].Get() != Artifact)
+	{
+		return;
+	}
+
+	Table->Artifacts[LocalIndex].Reset();
+	if (Table->FirstIndex != INDEX_NONE && ArtifactsByIndex.IsValidIndex(Table->FirstIndex + LocalIndex))
+	{
+		ArtifactsByIndex[Table->FirstIndex + LocalIndex].Reset();
+	}
+
+	if (--Table->NumRegistered <= 0)
+	{
+		LevelTables.Remove(LevelKey);
+	}
+}
+
+void UArtifactCollectionSubsystem::SetCollected(int32 Index, bool bCollected)
+{
+	if (Index != INDEX_NONE && Manager)
+	{
+		Manager->SetCollected(Index, bCollected);
+	}
+}
+
+bool UArtifactCollectionSubsystem::IsCollected(int32 Index) const
+{
+	return Index != INDEX_NONE && Manager && Manager->IsCollected(Index);
+}
+
+void UArtifactCollectionSubsystem::HandleManagerReplicated(AArtifactCollectionManager* InManager)
+{
+	if (!InManager || IsAuthority())
+	{
+		return;
+	}
+
+	Manager = InManager;
+
+	// Levels that registered before their block replicated
+	for (TPair<TObjectKey<ULevel>, FLevelTable>& Pair : LevelTables)
+	{
+		if (Pair.Value.FirstIndex == INDEX_NONE)
+		{
+			MapLevelTable(Pair.Value);
+		}
+	}
+
+	ApplyChangedBits();
+}
+
+bool UArtifactCollectionSubsystem::IsAuthority() const
+{
+	const UWorld* World = GetWorld();
+	return World && World->GetNetMode() != NM_Client;
+}
+
+AArtifactCollectionManager* UArtifactCollectionSubsystem::GetOrSpawnManager()
+{
+	if (!Manager && IsAuthority())
+	{
+		UWorld* World = GetWorld();
+		if (World->bIsTearingDown)
+		{
+			return nullptr;
+		}
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.ObjectFlags |= RF_Transient;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		Manager = World->SpawnActor<AArtifactCollectionManager>(SpawnParams);
+	}
+
+	return Manager;
+}
+
+UArtifactCollectionSubsystem::FLevelTable* UArtifactCollectionSubsystem::FindOrBuildLevelTable(ULevel* Level)
+{
+	if (!Level)
+	{
+		return nullptr;
+	}
+
+	const TObjectKey<ULevel> LevelKey(Level);
+	if (FLevelTable* Existing = LevelTables.Find(LevelKey))
+	{
+		return Existing;
+	}
+
+	TArray<FName> Names;
+	for (const AActor* Actor : Level->Actors)
+	{
+		const APointArtifact* Artifact = Cast<APointArtifact>(Actor);
+		if (Artifact && Artifact->UsesCollectionManager())
+		{
+			Names.Add(Artifact->GetFName());
+		}
+	}
+
+	if (Names.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	Names.Sort(&ArtifactCollection::NameLess);
+
+	FLevelTable& Table = LevelTables.Add(LevelKey);
+	Table.LevelName = FName(UWorld::RemovePIEPrefix(Level->GetOutermost()->GetName()));
+	Table.Names = MoveTemp(Names);
+	Table.Artifacts.SetNum(Table.Names.Num());
+
+	if (IsAuthority())
+	{
+		if (AArtifactCollectionManager* CollectionManager = GetOrSpawnManager())
+		{
+			Table.FirstIndex = CollectionManager->ReserveLevelBlock(Table.LevelName, Table.Names.Num());
+		}
+	}
+	else if (Manager)
+	{
+		MapLevelTable(Table);
+	}
+
+	return &Table;
+}
+
+int32 UArtifactCollectionSubsystem::FindLocalIndex(const FLevelTable& Table, const APointArtifact* Artifact)
+{
+	const FName Name = Artifact->GetFName();
+	const int32 LocalIndex = Algo::LowerBound(Table.Names, Name, &ArtifactCollection::NameLess);
+	return Table.Names.IsValidIndex(LocalIndex) && Table.Names[LocalIndex] == Name ? LocalIndex : INDEX_NONE;
+}
+
+void UArtifactCollectionSubsystem::MapLevelTable(FLevelTable& Table)
+{
+	int32 Num = 0;
+	const int32 FirstIndex = Manager->FindLevelBlock(Table.LevelName, Num);
+	if (FirstIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (Num != Table.Names.Num())
+	{
+		UE_LOG(LogArtifactCollection, Warning, TEXT("Level %s has %d managed artifacts locally but %d on the server"),
+			*Table.LevelName.ToString(), Table.Names.Num(), Num);
+		return;
+	}
+
+	Table.FirstIndex = FirstIndex;
+	if (ArtifactsByIndex.Num() < FirstIndex + Num)
+	{
+		ArtifactsByIndex.SetNum(FirstIndex + Num);
+	}
+
+	// Initial state, no feedback for pickups collected before we arrived
+	for (int32 LocalIndex = 0; LocalIndex < Num; ++LocalIndex)
+	{
+		APointArtifact* Artifact = Table.Artifacts[LocalIndex].Get();
+		ArtifactsByIndex[FirstIndex + LocalIndex] = Artifact;
+
+		if (Artifact)
+		{
+			Artifact->ApplyReplicatedCollection(Manager->IsCollected(FirstIndex + LocalIndex), false);
+		}
+	}
+}
+
+void UArtifactCollectionSubsystem::ApplyChangedBits()
+{
+	const TBitArray<>& Bits = Manager->GetCollectedBits().GetBits();
+	if (AppliedBits.Num() < Bits.Num())
+	{
+		AppliedBits.Add(false, Bits.Num() - AppliedBits.Num());
+	}
+
+	const int32 NumWords = FMath::DivideAndRoundUp(Bits.Num(), NumBitsPerDWORD);
+	const uint32* NewWords = Bits.GetData();
+	const uint32* AppliedWords = AppliedBits.GetData();
+
+	for (int32 Word = 0; Word < NumWords; ++Word)
+	{
+		uint32 Changed = NewWords[Word] ^ AppliedWords[Word];
+		while (Changed)
+		{
+			const int32 Index = Word * NumBitsPerDWORD + FMath::CountTrailingZeros(Changed);
+			Changed &= Changed - 1;
+
+			if (Index >= Bits.Num())
+			{
+				break;
+			}
+
+			if (APointArtifact* Artifact = ArtifactsByIndex.IsValidIndex(Index) ? ArtifactsByIndex[Index].Get() : nullptr)
+			{
+				Artifact->ApplyReplicatedCollection(Bits[Index], true);
+			}
+		}
+	}
+
+	AppliedBits = Bits;
+}
@@ -0,0 +1,113 @@
+#include "Subsystems/ArtifactPlacementSubsystem.h"
+
+#include "Collectables/Artifacts/PointArtifact.h"
+#include "Collectables/DataAssets/ArtifactData.h"
+#include "Collectables/DataAssets/ArtifactPlacementData.h"
+#include "Collectables/Placement/ArtifactPlacementCell.h"
+#include "Interfaces/Artifact.h"
+#include "Subsystems/ArtifactPoolSubsystem.h"
+#include "Subsystems/ArtifactRegistrySubsystem.h"
+
+bool UArtifactPlacementSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UArtifactPlacementSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (UArtifactRegistrySubsystem* Registry = InWorld.GetSubsystem<UArtifactRegistrySubsystem>())
+	{
+		CollectedHandle = Registry->OnArtifactCollected.AddUObject(this,
+			&UArtifactPlacementSubsystem::HandleArtifactCollected);
+	}
+}
+
+void UArtifactPlacementSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UArtifactRegistrySubsystem* Registry = World->GetSubsystem<UArtifactRegistrySubsystem>())
+		{
+			Registry->OnArtifactCollected.Remove(CollectedHandle);
+		}
+	}
+
+	CollectedPlacements.Reset();
+	TrackedArtifacts.Reset();
+	NumCollected = 0;
+
+	Super::Deinitialize();
+}
+
+bool UArtifactPlacementSubsystem::IsCollected(const UArtifactPlacementData* Data, int32 PlacementIndex) const
+{
+	const TBitArray<>* Collected = Data ? CollectedPlacements.Find(FSoftObjectPath(Data)) : nullptr;
+	return Collected && Collected->IsValidIndex(PlacementIndex) && (*Collected)[PlacementIndex];
+}
+
+void UArtifactPlacementSubsystem::TrackArtifact(APointArtifact* Artifact, AArtifactPlacementCell* Cell,
+	int32 PlacementIndex)
+{
+	if (!Artifact || !Cell || !Cell->GetPlacementData())
+	{
+		return;
+	}
+
+	FTrackedPlacement& Tracked = TrackedArtifacts.FindOrAdd(Artifact);
+	Tracked.Cell = Cell;
+	Tracked.DataPath = FSoftObjectPath(Cell->GetPlacementData());
+	Tracked.PlacementIndex = PlacementIndex;
+}
+
+void UArtifactPlacementSubsystem::UntrackArtifact(const APointArtifact* Artifact)
+{
+	TrackedArtifacts.Remove(Artifact);
+}
+
+void UArtifactPlacementSubsystem::HandleArtifactCollected(AActor* Collectable, ASkaterCharacterBase* Collector)
+{
+	const APointArtifact* Artifact = Cast<APointArtifact>(Collectable);
+	const FTrackedPlacement* Tracked = Artifact ? TrackedArtifacts.Find(Artifact) : nullptr;
+	const UArtifactData* Data = Artifact ? Artifact->GetArtifactData() : nullptr;
+	if (!Tracked || !Data)
+	{
+		return;
+	}
+
+	// A collection the artifact refused leaves it in play; the placement is still available
+	if (IArtifact::Execute_IsActive(Artifact))
+	{
+		return;
+	}
+
+	// Respawning artifacts come back in place by themselves
+	if (Data->RespawnDelay > 0.f && GetWorld()->GetSubsystem<UArtifactPoolSubsystem>())
+	{
+		return;
+	}
+
+	TBitArray<>& Collected = CollectedPlacements.FindOrAdd(Tracked->DataPath);
+	if (Collected.Num() <= Tracked->PlacementIndex)
+	{
+		Collected.Add(false, Tracked->PlacementIndex + 1 - Collected.Num());
+	}
+
+	if (!Collected[Tracked->PlacementIndex])
+	{
+		Collected[Tracked->PlacementIndex] = true;
+		++NumCollected;
+	}
+
+	// Persistent artifacts stay with the cell until it unloads; others went back to the pool
+	if (!Data->bIsToPersistAfterCollection)
+	{
+		if (AArtifactPlacementCell* Cell = Tracked->Cell.Get())
+		{
+			Cell->ForgetArtifact(Tracked->PlacementIndex);
+		}
+
+		TrackedArtifacts.Remove(Artifact);
+	}
+}
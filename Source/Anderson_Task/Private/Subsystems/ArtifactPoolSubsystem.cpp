@@ -0,0 +1,175 @@
+#include "Subsystems/ArtifactPoolSubsystem.h"
+
+#include "Collectables/Artifacts/PointArtifact.h"
+#include "Collectables/DataAssets/ArtifactData.h"
+#include "TimerManager.h"
+
+void UArtifactPoolSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		for (TPair<TObjectKey<APointArtifact>, FTimerHandle>& Pair : RespawnTimers)
+		{
+			World->GetTimerManager().ClearTimer(Pair.Value);
+		}
+	}
+
+	RespawnTimers.Reset();
+	FreeArtifacts.Reset();
+	PooledArtifacts.Reset();
+	OwnedArtifacts.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UArtifactPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+APointArtifact* UArtifactPoolSubsystem::AcquireArtifact(TSubclassOf<APointArtifact> ArtifactClass,
+	UArtifactData* Data, const FTransform& Transform)
+{
+	UWorld* World = GetWorld();
+	if (!World || !ArtifactClass)
+	{
+		return nullptr;
+	}
+
+	if (FPooledArtifactList* FreeList = FreeArtifacts.Find(ArtifactClass.Get()))
+	{
+		while (FreeList->Artifacts.Num() > 0)
+		{
+			APointArtifact* Pooled = FreeList->Artifacts.Pop(EAllowShrinking::No);
+			PooledArtifacts.Remove(Pooled);
+
+			// Pooled artifacts can still be destroyed with their level
+			if (IsValid(Pooled))
+			{
+				Pooled->ResetArtifact(Data, Transform);
+				return Pooled;
+			}
+		}
+	}
+
+	return SpawnArtifact(ArtifactClass, Data, Transform, true);
+}
+
+APointArtifact* UArtifactPoolSubsystem::SpawnArtifact(TSubclassOf<APointArtifact> ArtifactClass,
+	UArtifactData* Data, const FTransform& Transform, bool bActive)
+{
+	UWorld* World = GetWorld();
+	if (!World || !ArtifactClass)
+	{
+		return nullptr;
+	}
+
+	APointArtifact* Spawned = World->SpawnActorDeferred<APointArtifact>(ArtifactClass, Transform, nullptr,
+		nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	if (!Spawned)
+	{
+		return nullptr;
+	}
+
+	OwnedArtifacts.Add(Spawned);
+
+	// Inactive artifacts begin play hidden and never register for collection
+	if (bActive)
+	{
+		Spawned->ResetArtifact(Data, Transform);
+	}
+	else
+	{
+		Spawned->DeactivateArtifact();
+	}
+
+	Spawned->FinishSpawning(Transform);
+	return Spawned;
+}
+
+void UArtifactPoolSubsystem::AddToFreeList(APointArtifact* Artifact)
+{
+	bool bAlreadyPooled = false;
+	PooledArtifacts.Add(Artifact, &bAlreadyPooled);
+	if (!bAlreadyPooled)
+	{
+		FreeArtifacts.FindOrAdd(Artifact->GetClass()).Artifacts.Add(Artifact);
+	}
+}
+
+void UArtifactPoolSubsystem::ReleaseArtifact(APointArtifact* Artifact)
+{
+	if (!IsValid(Artifact))
+	{
+		return;
+	}
+
+	CancelRespawn(Artifact);
+	Artifact->DeactivateArtifact();
+
+	// Level-placed artifacts keep their place, and possibly their collection manager slot
+	if (OwnedArtifacts.Contains(Artifact))
+	{
+		AddToFreeList(Artifact);
+	}
+}
+
+void UArtifactPoolSubsystem::ScheduleRespawn(APointArtifact* Artifact, float Delay)
+{
+	UWorld* World = GetWorld();
+	if (!World || !IsValid(Artifact))
+	{
+		return;
+	}
+
+	FTimerHandle& Handle = RespawnTimers.FindOrAdd(Artifact);
+	World->GetTimerManager().SetTimer(Handle,
+		FTimerDelegate::CreateUObject(this, &UArtifactPoolSubsystem::RespawnArtifact,
+			TWeakObjectPtr<APointArtifact>(Artifact)),
+		Delay, false);
+}
+
+void UArtifactPoolSubsystem::PrewarmPool(TSubclassOf<APointArtifact> ArtifactClass, int32 Count)
+{
+	for (int32 i = 0; i < Count; ++i)
+	{
+		if (APointArtifact* Artifact = SpawnArtifact(ArtifactClass, nullptr, FTransform::Identity, false))
+		{
+			AddToFreeList(Artifact);
+		}
+	}
+}
+
+int32 UArtifactPoolSubsystem::GetNumPooled() const
+{
+	int32 NumPooled = 0;
+	for (const TPair<TObjectPtr<UClass>, FPooledArtifactList>& Pair : FreeArtifacts)
+	{
+		NumPooled += Pair.Value.Artifacts.Num();
+	}
+	return NumPooled;
+}
+
+void UArtifactPoolSubsystem::RespawnArtifact(TWeakObjectPtr<APointArtifact> Artifact)
+{
+	APointArtifact* Respawned = Artifact.Get();
+	if (!Respawned)
+	{
+		return;
+	}
+
+	RespawnTimers.Remove(Respawned);
+	Respawned->ResetArtifact(Respawned->GetArtifactData(), Respawned->GetActorTransform());
+}
+
+void UArtifactPoolSubsystem::CancelRespawn(const APointArtifact* Artifact)
+{
+	FTimerHandle Handle;
+	if (RespawnTimers.RemoveAndCopyValue(Artifact, Handle))
+	{
+		if (UWorld* World = GetWorld())
+		{
+			World->GetTimerManager().ClearTimer(Handle);
+		}
+	}
+}
@@ -0,0 +1,385 @@
+#include "Subsystems/ArtifactRegistrySubsystem.h"
+
+#include "Characters/SkaterCharacterBase.h"
+#include "Collectables/DataAssets/ArtifactData.h"
+#include "Collectables/Rendering/ArtifactInstanceManager.h"
+#include "Components/CapsuleComponent.h"
+#include "Interfaces/Collectable.h"
+#include "Subsystems/ArtifactStreamingSubsystem.h"
+
+DEFINE_LOG_CATEGORY(LogArtifactRegistry);
+
+void UArtifactRegistrySubsystem::Deinitialize()
+{
+	Positions.Reset();
+	Radii.Reset();
+	ArtifactDatas.Reset();
+	Collectables.Reset();
+	CellKeys.Reset();
+	DenseToHandle.Reset();
+	HandleToDense.Reset();
+	FreeHandles.Reset();
+	Cells.Reset();
+	Collectors.Reset();
+	InstanceManager = nullptr;
+
+	Super::Deinitialize();
+}
+
+bool UArtifactRegistrySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UArtifactRegistrySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UArtifactRegistrySubsystem, STATGROUP_Tickables);
+}
+
+bool UArtifactRegistrySubsystem::IsTickable() const
+{
+	return Collectors.Num() > 0 && Positions.Num() > 0;
+}
+
+void UArtifactRegistrySubsystem::Tick(float DeltaTime)
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	if (World->GetNetMode() != NM_DedicatedServer)
+	{
+		ProximityCheckAccumulator += DeltaTime;
+		if (ProximityCheckAccumulator >= ProximityCheckInterval)
+		{
+			ProximityCheckAccumulator = 0.f;
+			RequestNearbyFeedback();
+		}
+	}
+
+	// Collection is server authoritative
+	if (World->GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	// Collection may destroy artifacts and unregister them, so hits are gathered first and
+	// dispatched afterwards against weak pointers.
+	TArray<int32> Overlaps;
+	TArray<TPair<TWeakObjectPtr<AActor>, TWeakObjectPtr<ASkaterCharacterBase>>> Hits;
+
+	for (int32 i = Collectors.Num() - 1; i >= 0; --i)
+	{
+		const ASkaterCharacterBase* Collector = Collectors[i].Get();
+		if (!Collector)
+		{
+			Collectors.RemoveAtSwap(i);
+			continue;
+		}
+
+		Overlaps.Reset();
+		GatherOverlaps(Collector, Overlaps);
+
+		for (const int32 Handle : Overlaps)
+		{
+			Hits.Emplace(Collectables[HandleToDense[Handle]], Collectors[i]);
+		}
+	}
+
+	for (const TPair<TWeakObjectPtr<AActor>, TWeakObjectPtr<ASkaterCharacterBase>>& Hit : Hits)
+	{
+		AActor* Collectable = Hit.Key.Get();
+		ASkaterCharacterBase* Collector = Hit.Value.Get();
+		if (!Collectable || !Collector)
+		{
+			continue;
+		}
+
+		if (ICollectable::Execute_CanBeCollected(Collectable, Collector)
+			&& ICollectable::Execute_OnCollected(Collectable, Collector))
+		{
+			OnArtifactCollected.Broadcast(Collectable, Collector);
+		}
+	}
+}
+
+int32 UArtifactRegistrySubsystem::RegisterArtifact(AActor* Collectable, UArtifactData* Data, float Radius)
+{
+	if (!Collectable || !Collectable->Implements<UCollectable>())
+	{
+		UE_LOG(LogArtifactRegistry, Warning, TEXT("RegisterArtifact: %s does not implement ICollectable"),
+			*GetNameSafe(Collectable));
+		return INDEX_NONE;
+	}
+
+	int32 Handle;
+	if (FreeHandles.Num() > 0)
+	{
+		Handle = FreeHandles.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		Handle = HandleToDense.Add(INDEX_NONE);
+	}
+
+	const FVector Location = Collectable->GetActorLocation();
+	const FIntVector CellKey = GetCellKey(Location);
+
+	HandleToDense[Handle] = Positions.Add(Location);
+	Radii.Add(Radius);
+	ArtifactDatas.Add(Data);
+	Collectables.Add(Collectable);
+	CellKeys.Add(CellKey);
+	DenseToHandle.Add(Handle);
+
+	Cells.FindOrAdd(CellKey).Add(Handle);
+	MaxRadius = FMath::Max(MaxRadius, Radius);
+
+	return Handle;
+}
+
+void UArtifactRegistrySubsystem::UnregisterArtifact(int32 Handle)
+{
+	if (!HandleToDense.IsValidIndex(Handle) || HandleToDense[Handle] == INDEX_NONE)
+	{
+		return;
+	}
+
+	const int32 DenseIndex = HandleToDense[Handle];
+
+	if (TArray<int32>* Cell = Cells.Find(CellKeys[DenseIndex]))
+	{
+		Cell->RemoveSingleSwap(Handle, EAllowShrinking::No);
+		if (Cell->IsEmpty())
+		{
+			Cells.Remove(CellKeys[DenseIndex]);
+		}
+	}
+
+	// Swap-remove keeps the SoA arrays packed; fix up the handle of the moved entry
+	const int32 LastIndex = Positions.Num() - 1;
+	if (DenseIndex != LastIndex)
+	{
+		HandleToDense[DenseToHandle[LastIndex]] = DenseIndex;
+	}
+
+	Positions.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	Radii.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	ArtifactDatas.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	Collectables.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	CellKeys.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	DenseToHandle.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+
+	HandleToDense[Handle] = INDEX_NONE;
+	FreeHandles.Add(Handle);
+}
+
+void UArtifactRegistrySubsystem::RegisterCollector(ASkaterCharacterBase* Collector)
+{
+	if (Collector)
+	{
+		Collectors.AddUnique(Collector);
+	}
+}
+
+void UArtifactRegistrySubsystem::UnregisterCollector(ASkaterCharacterBase* Collector)
+{
+	Collectors.RemoveSingleSwap(Collector);
+}
+
+AArtifactInstanceManager* UArtifactRegistrySubsystem::GetInstanceManager()
+{
+	if (!InstanceManager)
+	{
+		UWorld* World = GetWorld();
+		if (!World || World->bIsTearingDown)
+		{
+			return nullptr;
+		}
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.ObjectFlags |= RF_Transient;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		InstanceManager = World->SpawnActor<AArtifactInstanceManager>(SpawnParams);
+	}
+
+	return InstanceManager;
+}
+
+FIntVector UArtifactRegistrySubsystem::GetCellKey(const FVector& Location) const
+{
+	return FIntVector(
+		FMath::FloorToInt32(Location.X / CellSize),
+		FMath::FloorToInt32(Location.Y / CellSize),
+		FMath::FloorToInt32(Location.Z / CellSize));
+}
+
+void UArtifactRegistrySubsystem::GatherOverlaps(const ASkaterCharacterBase* Collector, TArray<int32>& OutHandles) const
+{
+	const UCapsuleComponent* Capsule = Collector->GetCapsuleComponent();
+	if (!Capsule)
+	{
+		return;
+	}
+
+	const float CapsuleRadius = Capsule->GetScaledCapsuleRadius();
+	const float CapsuleHalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+	const FVector Center = Capsule->GetComponentLocation();
+	const FVector Axis = Capsule->GetUpVector() * (CapsuleHalfHeight - CapsuleRadius);
+	const FVector SegmentStart = Center - Axis;
+	const FVector SegmentEnd = Center + Axis;
+
+	const FVector Extent(CapsuleRadius + MaxRadius, CapsuleRadius + MaxRadius, CapsuleHalfHeight + MaxRadius);
+	const FIntVector MinCell = GetCellKey(Center - Extent);
+	const FIntVector MaxCell = GetCellKey(Center + Extent);
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+			{
+				const TArray<int32>* Cell = Cells.Find(FIntVector(X, Y, Z));
+				if (!Cell)
+				{
+					continue;
+				}
+
+				for (const int32 Handle : *Cell)
+				{
+					const int32 DenseIndex = HandleToDense[Handle];
+					const float Reach = CapsuleRadius + Radii[DenseIndex];
+					const float DistSq = FMath::PointDistToSegmentSquared(Positions[DenseIndex], SegmentStart, SegmentEnd);
+
+					if (DistSq <= Reach * Reach)
+					{
+						OutHandles.Add(Handle);
+					}
+				}
+			}
+		}
+	}
+}
+
+AActor* UArtifactRegistrySubsystem::FindNearestArtifact(const FVector& Location, float SearchRadius,
+	FVector& OutLocation) const
+{
+	const FIntVector Origin = GetCellKey(Location);
+	const int32 MaxRing = FMath::CeilToInt32(SearchRadius / CellSize);
+
+	int32 BestDenseIndex = INDEX_NONE;
+	float BestDistSq = FMath::Square(SearchRadius);
+
+	auto VisitColumn = [&](int32 X, int32 Y)
+	{
+		for (int32 Z = Origin.Z - 1; Z <= Origin.Z + 1; ++Z)
+		{
+			const TArray<int32>* Cell = Cells.Find(FIntVector(X, Y, Z));
+			if (!Cell)
+			{
+				continue;
+			}
+
+			for (const int32 Handle : *Cell)
+			{
+				const int32 DenseIndex = HandleToDense[Handle];
+				const float DistSq = FVector::DistSquared(Positions[DenseIndex], Location);
+
+				if (DistSq < BestDistSq && Collectables[DenseIndex].IsValid())
+				{
+					BestDistSq = DistSq;
+					BestDenseIndex = DenseIndex;
+				}
+			}
+		}
+	};
+
+	for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+	{
+		// Cells on this ring are at least (Ring - 1) cells away
+		if (BestDenseIndex != INDEX_NONE && FMath::Square((Ring - 1) * CellSize) > BestDistSq)
+		{
+			break;
+		}
+
+		if (Ring == 0)
+		{
+			VisitColumn(Origin.X, Origin.Y);
+			continue;
+		}
+
+		for (int32 Offset = -Ring; Offset <= Ring; ++Offset)
+		{
+			VisitColumn(Origin.X + Offset, Origin.Y - Ring);
+			VisitColumn(Origin.X + Offset, Origin.Y + Ring);
+		}
+
+		for (int32 Offset = -Ring + 1; Offset <= Ring - 1; ++Offset)
+		{
+			VisitColumn(Origin.X - Ring, Origin.Y + Offset);
+			VisitColumn(Origin.X + Ring, Origin.Y + Offset);
+		}
+	}
+
+	if (BestDenseIndex == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	OutLocation = Positions[BestDenseIndex];
+	return Collectables[BestDenseIndex].Get();
+}
+
+void UArtifactRegistrySubsystem::RequestNearbyFeedback()
+{
+	UArtifactStreamingSubsystem* Streaming = GetWorld()->GetSubsystem<UArtifactStreamingSubsystem>();
+	if (!Streaming)
+	{
+		return;
+	}
+
+	const float PreloadDistanceSq = FMath::Square(FeedbackPreloadDistance);
+
+	for (const TWeakObjectPtr<ASkaterCharacterBase>& WeakCollector : Collectors)
+	{
+		const ASkaterCharacterBase* Collector = WeakCollector.Get();
+		if (!Collector)
+		{
+			continue;
+		}
+
+		const FVector Center = Collector->GetActorLocation();
+		const FVector Extent(FeedbackPreloadDistance, FeedbackPreloadDistance, CellSize);
+		const FIntVector MinCell = GetCellKey(Center - Extent);
+		const FIntVector MaxCell = GetCellKey(Center + Extent);
+
+		for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+		{
+			for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+			{
+				for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+				{
+					const TArray<int32>* Cell = Cells.Find(FIntVector(X, Y, Z));
+					if (!Cell)
+					{
+						continue;
+					}
+
+					for (const int32 Handle : *Cell)
+					{
+						const int32 DenseIndex = HandleToDense[Handle];
+						const UArtifactData* Data = ArtifactDatas[DenseIndex];
+
+						if (Data && !Data->AreFeedbackAssetsLoaded() &&
+							FVector::DistSquaredXY(Positions[DenseIndex], Center) <= PreloadDistanceSq)
+						{
+							Streaming->RequestFeedback(Data);
+						}
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,172 @@
+#include "Subsystems/ArtifactStreamingSubsystem.h"
+
+#include "Collectables/Artifacts/PointArtifact.h"
+#include "Collectables/DataAssets/ArtifactData.h"
+#include "Collectables/DataAssets/ArtifactPlacementData.h"
+#include "Collectables/Placement/ArtifactPlacementCell.h"
+#include "Engine/AssetManager.h"
+#include "EngineUtils.h"
+#include "Subsystems/FeedbackPoolSubsystem.h"
+
+void UArtifactStreamingSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (!UAssetManager::IsInitialized() || InWorld.GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+
+	// Only the artifact types this world actually uses
+	TSet<const UArtifactData*> ReferencedData;
+	for (TActorIterator<APointArtifact> It(&InWorld); It; ++It)
+	{
+		ReferencedData.Add(It->GetArtifactData());
+	}
+
+	for (TActorIterator<AArtifactPlacementCell> It(&InWorld); It; ++It)
+	{
+		if (const UArtifactPlacementData* PlacementData = It->GetPlacementData())
+		{
+			for (const UArtifactData* Data : PlacementData->ArtifactTypes)
+			{
+				ReferencedData.Add(Data);
+			}
+		}
+	}
+
+	for (const UArtifactData* Data : ReferencedData)
+	{
+		if (!Data || Data->AreVisualsLoaded())
+		{
+			continue;
+		}
+
+		TSharedPtr<FStreamableHandle> Handle = LoadBundle(Data, UArtifactData::VisualBundle, FStreamableDelegate());
+		if (Handle.IsValid())
+		{
+			VisualPreloadHandles.Add(Handle);
+		}
+	}
+}
+
+void UArtifactStreamingSubsystem::Deinitialize()
+{
+	for (const TSharedPtr<FStreamableHandle>& Handle : VisualPreloadHandles)
+	{
+		if (Handle.IsValid())
+		{
+			Handle->CancelHandle();
+		}
+	}
+	VisualPreloadHandles.Reset();
+
+	for (const TSharedPtr<FStreamableHandle>& Handle : VisualHandles)
+	{
+		if (Handle.IsValid())
+		{
+			Handle->CancelHandle();
+		}
+	}
+	VisualHandles.Reset();
+
+	for (const TPair<TObjectKey<UArtifactData>, TSharedPtr<FStreamableHandle>>& Pair : FeedbackHandles)
+	{
+		if (Pair.Value.IsValid())
+		{
+			Pair.Value->CancelHandle();
+		}
+	}
+	FeedbackHandles.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UArtifactStreamingSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UArtifactStreamingSubsystem::RequestVisuals(const UArtifactData* Data, FStreamableDelegate OnLoaded)
+{
+	if (!Data)
+	{
+		return;
+	}
+
+	if (Data->AreVisualsLoaded() || !UAssetManager::IsInitialized())
+	{
+		OnLoaded.ExecuteIfBound();
+		return;
+	}
+
+	TSharedPtr<FStreamableHandle> Handle = LoadBundle(Data, UArtifactData::VisualBundle, OnLoaded);
+
+	// Drop handles of loads that already completed before keeping a new one
+	VisualHandles.RemoveAllSwap([](const TSharedPtr<FStreamableHandle>& Existing)
+	{
+		return !Existing.IsValid() || Existing->HasLoadCompletedOrStalled();
+	}, EAllowShrinking::No);
+
+	if (Handle.IsValid())
+	{
+		VisualHandles.Add(Handle);
+	}
+}
+
+void UArtifactStreamingSubsystem::RequestFeedback(const UArtifactData* Data)
+{
+	if (!Data || FeedbackHandles.Contains(Data) || !UAssetManager::IsInitialized())
+	{
+		return;
+	}
+
+	if (Data->AreFeedbackAssetsLoaded())
+	{
+		FeedbackHandles.Add(Data, nullptr);
+		OnFeedbackLoaded(Data);
+		return;
+	}
+
+	FeedbackHandles.Add(Data, LoadBundle(Data, UArtifactData::FeedbackBundle,
+		FStreamableDelegate::CreateUObject(this, &UArtifactStreamingSubsystem::OnFeedbackLoaded,
+			TWeakObjectPtr<const UArtifactData>(Data))));
+}
+
+TSharedPtr<FStreamableHandle> UArtifactStreamingSubsystem::LoadBundle(const UArtifactData* Data, FName Bundle,
+	FStreamableDelegate OnLoaded)
+{
+	UAssetManager& AssetManager = UAssetManager::Get();
+
+	// Bundle state can only be changed on primary assets the AssetManager loaded itself
+	TSharedPtr<FStreamableHandle> Handle = AssetManager.LoadPrimaryAsset(Data->GetPrimaryAssetId(), { Bundle },
+		OnLoaded);
+	if (Handle.IsValid())
+	{
+		return Handle;
+	}
+
+	// Not a scanned primary asset, or nothing to load; stream whatever the bundle still misses
+	TArray<FSoftObjectPath> Paths;
+	Data->GetUnloadedBundleAssets(Bundle, Paths);
+	if (Paths.IsEmpty())
+	{
+		OnLoaded.ExecuteIfBound();
+		return nullptr;
+	}
+
+	return AssetManager.GetStreamableManager().RequestAsyncLoad(MoveTemp(Paths), OnLoaded);
+}
+
+void UArtifactStreamingSubsystem::OnFeedbackLoaded(TWeakObjectPtr<const UArtifactData> Data)
+{
+	if (!Data.IsValid())
+	{
+		return;
+	}
+
+	if (UFeedbackPoolSubsystem* Pool = GetWorld()->GetSubsystem<UFeedbackPoolSubsystem>())
+	{
+		Pool->PrewarmFeedback(Data.Get());
+	}
+}
@@ -0,0 +1,187 @@
+#include "Subsystems/CollectionAnalyticsSubsystem.h"
+
+#include "Characters/SkaterCharacterBase.h"
+#include "Collectables/DataAssets/ArtifactData.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerState.h"
+#include "Misc/Paths.h"
+
+bool UCollectionAnalyticsSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCollectionAnalyticsSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Collections and placements only happen on the authority; worlds that never begin play
+	// (editor previews, commandlets) never get here
+	if (!bEnableAnalytics || InWorld.GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	const FString MapName = UWorld::RemovePIEPrefix(InWorld.GetMapName());
+
+	FCollectionAnalyticsSettings Settings;
+	Settings.LogDirectory = FPaths::ProjectSavedDir() / TEXT("Analytics");
+	Settings.LogPrefix = FString::Printf(TEXT("%s_%s"), *MapName, *FDateTime::Now().ToString());
+	Settings.MaxFileBytes = static_cast<int64>(MaxLogFileMB) * 1024 * 1024;
+	Settings.MaxFiles = MaxLogFiles;
+	Settings.CellSize = CellSize;
+	Settings.SampleInterval = SampleInterval;
+	Settings.DrainIntervalMs = static_cast<uint32>(DrainIntervalMs);
+
+	Worker = MakeUnique<FCollectionAnalyticsWorker>(Settings);
+	if (!Worker->Start())
+	{
+		UE_LOG(LogCollectionAnalytics, Warning, TEXT("No worker thread available, collection analytics disabled"));
+		Worker.Reset();
+	}
+}
+
+void UCollectionAnalyticsSubsystem::Deinitialize()
+{
+	// Blocks until the final drain is written
+	Worker.Reset();
+	ArtifactDataIds.Reset();
+	RecordedPlacements.Reset();
+	Skaters.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UCollectionAnalyticsSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCollectionAnalyticsSubsystem, STATGROUP_Tickables);
+}
+
+bool UCollectionAnalyticsSubsystem::IsTickable() const
+{
+	return Worker.IsValid() && Skaters.Num() > 0;
+}
+
+void UCollectionAnalyticsSubsystem::Tick(float DeltaTime)
+{
+	SampleAccumulator += DeltaTime;
+	if (SampleAccumulator >= SampleInterval)
+	{
+		// Keep the remainder so samples stay on the interval grid
+		SampleAccumulator = FMath::Fmod(SampleAccumulator, SampleInterval);
+		SampleSkaters();
+	}
+}
+
+void UCollectionAnalyticsSubsystem::RegisterSkater(ASkaterCharacterBase* Skater)
+{
+	if (Worker && Skater && Skater->HasAuthority())
+	{
+		Skaters.AddUnique(Skater);
+	}
+}
+
+void UCollectionAnalyticsSubsystem::UnregisterSkater(ASkaterCharacterBase* Skater)
+{
+	Skaters.RemoveSwap(Skater);
+}
+
+void UCollectionAnalyticsSubsystem::SampleSkaters()
+{
+	const float Time = GetWorld()->GetTimeSeconds();
+
+	for (const TWeakObjectPtr<ASkaterCharacterBase>& Skater : Skaters)
+	{
+		if (const ASkaterCharacterBase* SkaterPtr = Skater.Get())
+		{
+			FSkaterMovementSample Sample;
+			Sample.SkaterId = GetPlayerId(SkaterPtr);
+			Sample.Location = FVector3f(SkaterPtr->GetActorLocation());
+			Sample.Time = Time;
+
+			Worker->Enqueue(Sample);
+		}
+	}
+}
+
+void UCollectionAnalyticsSubsystem::RecordCollection(const AActor* Collector, const UArtifactData* Data,
+	const FVector& Location, int32 Points)
+{
+	if (!Worker)
+	{
+		return;
+	}
+
+	FSkaterCollectionEvent Event;
+	Event.CollectorId = GetPlayerId(Collector);
+	Event.ArtifactDataId = GetArtifactDataId(Data);
+	Event.Location = FVector3f(Location);
+	Event.Time = GetWorld()->GetTimeSeconds();
+	Event.Points = Points;
+
+	Worker->Enqueue(Event);
+}
+
+void UCollectionAnalyticsSubsystem::RecordPlacement(const UArtifactData* Data, const FVector& Location)
+{
+	if (!Worker)
+	{
+		return;
+	}
+
+	const uint32 ArtifactDataId = GetArtifactDataId(Data);
+
+	const FIntVector RoundedLocation(FMath::RoundToInt(Location.X), FMath::RoundToInt(Location.Y),
+		FMath::RoundToInt(Location.Z));
+
+	bool bAlreadyRecorded = false;
+	RecordedPlacements.Add(TPair<uint32, FIntVector>(ArtifactDataId, RoundedLocation), &bAlreadyRecorded);
+	if (bAlreadyRecorded)
+	{
+		return;
+	}
+
+	FSkaterArtifactPlacement Placement;
+	Placement.ArtifactDataId = ArtifactDataId;
+	Placement.Location = FVector3f(Location);
+	Placement.Time = GetWorld()->GetTimeSeconds();
+
+	Worker->Enqueue(Placement);
+}
+
+void UCollectionAnalyticsSubsystem::GetSnapshot(FCollectionAnalyticsSnapshot& OutSnapshot) const
+{
+	if (Worker)
+	{
+		Worker->GetSnapshot(OutSnapshot);
+	}
+	else
+	{
+		OutSnapshot = FCollectionAnalyticsSnapshot();
+	}
+}
+
+uint32 UCollectionAnalyticsSubsystem::GetPlayerId(const AActor* Actor)
+{
+	const APawn* Pawn = Cast<APawn>(Actor);
+	const APlayerState* PlayerState = Pawn ? Pawn->GetPlayerState() : nullptr;
+	return PlayerState ? static_cast<uint32>(PlayerState->GetPlayerId()) : 0;
+}
+
+uint32 UCollectionAnalyticsSubsystem::GetArtifactDataId(const UArtifactData* Data)
+{
+	if (!Data)
+	{
+		return 0;
+	}
+
+	if (const uint32* Id = ArtifactDataIds.Find(Data))
+	{
+		return *Id;
+	}
+
+	// Hash the asset ID string rather than the FName, whose hash differs between runs
+	const uint32 Id = FCrc::StrCrc32(*Data->GetPrimaryAssetId().ToString());
+	ArtifactDataIds.Add(Data, Id);
+	return Id;
+}
@@ -0,0 +1,382 @@
+#include "Subsystems/FeedbackPoolSubsystem.h"
+
+#include "AudioDevice.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Collectables/DataAssets/ArtifactData.h"
+#include "Components/AudioComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+#include "NiagaraComponent.h"
+#include "NiagaraFunctionLibrary.h"
+#include "Particles/ParticleSystem.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "Subsystems/ArtifactStreamingSubsystem.h"
+
+void UFeedbackPoolSubsystem::Deinitialize()
+{
+	for (UAudioComponent* AudioComponent : AllAudio)
+	{
+		if (IsValid(AudioComponent))
+		{
+			AudioComponent->OnAudioFinishedNative.RemoveAll(this);
+			AudioComponent->Stop();
+			AudioComponent->DestroyComponent();
+		}
+	}
+
+	AllAudio.Reset();
+	FreeAudio.Reset();
+	ActiveAudio.Reset();
+	ActiveEffects.Reset();
+	ComponentSerials.Reset();
+	KnownEffectComponents.Reset();
+	PrewarmedData.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UFeedbackPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFeedbackPoolSubsystem::PrewarmFeedback(const UArtifactData* Data)
+{
+	if (!Data || PrewarmedData.Contains(Data) || GetWorld()->GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+
+	// Pre-warmed again by the streaming subsystem once the feedback bundle arrives
+	if (!Data->AreFeedbackAssetsLoaded())
+	{
+		return;
+	}
+
+	PrewarmedData.Add(Data);
+
+	for (int32 i = 0; i < Data->FeedbackPrewarmCount; ++i)
+	{
+		if (USoundBase* Sound = Data->CollectionSound.Get())
+		{
+			FAudioDevice::FCreateComponentParams Params(GetWorld());
+			if (UAudioComponent* AudioComponent = FAudioDevice::CreateComponent(Sound, Params))
+			{
+				AudioComponent->bAutoDestroy = false;
+				AudioComponent->OnAudioFinishedNative.AddUObject(this, &UFeedbackPoolSubsystem::HandleAudioFinished);
+				AllAudio.Add(AudioComponent);
+				FreeAudio.FindOrAdd(Sound).Components.Add(AudioComponent);
+			}
+		}
+
+		if (UFXSystemAsset* Effect = Data->CollectionEffect.Get())
+		{
+			UFXSystemComponent* EffectComponent = SpawnEffect(Effect, FTransform::Identity, true);
+			if (UNiagaraComponent* NiagaraComponent = Cast<UNiagaraComponent>(EffectComponent))
+			{
+				KnownEffectComponents.Add(NiagaraComponent);
+				NiagaraComponent->ReleaseToPool();
+			}
+			else if (UParticleSystemComponent* ParticleComponent = Cast<UParticleSystemComponent>(EffectComponent))
+			{
+				KnownEffectComponents.Add(ParticleComponent);
+				ParticleComponent->ReleaseToPool();
+			}
+		}
+	}
+}
+
+FCollectionFeedbackHandle UFeedbackPoolSubsystem::PlayFeedback(const UArtifactData* Data, const FTransform& Transform)
+{
+	FCollectionFeedbackHandle Handle;
+	if (!Data)
+	{
+		return Handle;
+	}
+
+	if (!IsWithinCullDistance(Transform.GetLocation()))
+	{
+		++Stats.Culled;
+		return Handle;
+	}
+
+	// Proximity streaming normally loads feedback before pickup; if it hasn't, play what is
+	// resident and request the rest
+	if (!Data->AreFeedbackAssetsLoaded())
+	{
+		if (UArtifactStreamingSubsystem* Streaming = GetWorld()->GetSubsystem<UArtifactStreamingSubsystem>())
+		{
+			Streaming->RequestFeedback(Data);
+		}
+	}
+
+	if (USoundBase* Sound = Data->CollectionSound.Get())
+	{
+		int32 EvictIndex = INDEX_NONE;
+		if (!ReserveSlot(ActiveAudio, MaxConcurrentAudio, Data->FeedbackPriority, EvictIndex))
+		{
+			++Stats.Culled;
+		}
+		else if (UAudioComponent* AudioComponent = AcquireAudio(Sound))
+		{
+			EvictSlot(ActiveAudio, EvictIndex);
+
+			AudioComponent->SetWorldLocation(Transform.GetLocation());
+			AudioComponent->Play();
+
+			Handle.Audio = AudioComponent;
+			Handle.AudioSerial = IssueSerial(AudioComponent);
+			ActiveAudio.Add({ AudioComponent, Data->FeedbackPriority, Handle.AudioSerial });
+		}
+	}
+
+	if (UFXSystemAsset* Effect = Data->CollectionEffect.Get())
+	{
+		int32 EvictIndex = INDEX_NONE;
+		if (!ReserveSlot(ActiveEffects, MaxConcurrentEffects, Data->FeedbackPriority, EvictIndex))
+		{
+			++Stats.Culled;
+		}
+		else if (UFXSystemComponent* EffectComponent = SpawnEffect(Effect, Transform, false))
+		{
+			EvictSlot(ActiveEffects, EvictIndex);
+
+			bool bAlreadyKnown = false;
+			KnownEffectComponents.Add(EffectComponent, &bAlreadyKnown);
+			if (bAlreadyKnown)
+			{
+				++Stats.Hits;
+			}
+			else
+			{
+				++Stats.Misses;
+			}
+
+			Handle.Effect = EffectComponent;
+			Handle.EffectSerial = IssueSerial(EffectComponent);
+			ActiveEffects.Add({ EffectComponent, Data->FeedbackPriority, Handle.EffectSerial });
+		}
+	}
+
+	return Handle;
+}
+
+void UFeedbackPoolSubsystem::StopFeedback(FCollectionFeedbackHandle& Handle)
+{
+	// Stopped audio reports back through HandleAudioFinished; auto-release effects return to the
+	// engine pool once deactivation completes. Components reissued since the handle was made
+	// belong to other feedback and are left alone.
+	UAudioComponent* AudioComponent = Handle.Audio.Get();
+	if (AudioComponent && IsCurrentSerial(AudioComponent, Handle.AudioSerial))
+	{
+		AudioComponent->Stop();
+	}
+
+	UFXSystemComponent* EffectComponent = Handle.Effect.Get();
+	if (EffectComponent && IsCurrentSerial(EffectComponent, Handle.EffectSerial))
+	{
+		ComponentSerials.Remove(EffectComponent);
+		EffectComponent->Deactivate();
+	}
+
+	Handle = FCollectionFeedbackHandle();
+}
+
+int32 UFeedbackPoolSubsystem::GetNumLiveComponents() const
+{
+	int32 NumLive = 0;
+	for (const FActiveFeedback& Entry : ActiveAudio)
+	{
+		NumLive += Entry.Component.IsValid() && Entry.Component->IsActive() ? 1 : 0;
+	}
+
+	for (const FActiveFeedback& Entry : ActiveEffects)
+	{
+		NumLive += Entry.Component.IsValid() && Entry.Component->IsActive() ? 1 : 0;
+	}
+
+	return NumLive;
+}
+
+bool UFeedbackPoolSubsystem::IsWithinCullDistance(const FVector& Location) const
+{
+	const float CullDistanceSq = FMath::Square(CullDistance);
+
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (!PC || !PC->IsLocalController() || !PC->PlayerCameraManager)
+		{
+			continue;
+		}
+
+		if (FVector::DistSquared(PC->PlayerCameraManager->GetCameraLocation(), Location) <= CullDistanceSq)
+		{
+			return true;
+		}
+	}
+
+	// No local view (e.g. dedicated server) means nobody can perceive the feedback
+	return false;
+}
+
+bool UFeedbackPoolSubsystem::ReserveSlot(TArray<FActiveFeedback>& Active, int32 MaxConcurrent, int32 Priority,
+	int32& OutEvictIndex)
+{
+	OutEvictIndex = INDEX_NONE;
+
+	// Finished components, and effects the engine pool handed out again, no longer hold a slot
+	Active.RemoveAllSwap([this](const FActiveFeedback& Entry)
+	{
+		const USceneComponent* Component = Entry.Component.Get();
+		if (!Component || !IsCurrentSerial(Component, Entry.Serial))
+		{
+			return true;
+		}
+
+		if (!Component->IsActive())
+		{
+			ComponentSerials.Remove(Component);
+			return true;
+		}
+
+		return false;
+	}, EAllowShrinking::No);
+
+	if (Active.Num() < MaxConcurrent)
+	{
+		return true;
+	}
+
+	int32 LowestIndex = 0;
+	for (int32 i = 1; i < Active.Num(); ++i)
+	{
+		if (Active[i].Priority < Active[LowestIndex].Priority)
+		{
+			LowestIndex = i;
+		}
+	}
+
+	if (!Active.IsValidIndex(LowestIndex) || Active[LowestIndex].Priority >= Priority)
+	{
+		return false;
+	}
+
+	OutEvictIndex = LowestIndex;
+	return true;
+}
+
+void UFeedbackPoolSubsystem::EvictSlot(TArray<FActiveFeedback>& Active, int32 Index)
+{
+	if (!Active.IsValidIndex(Index))
+	{
+		return;
+	}
+
+	// Steal the slot from lower priority feedback
+	USceneComponent* Stolen = Active[Index].Component.Get();
+	Active.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+	if (!Stolen)
+	{
+		return;
+	}
+
+	ComponentSerials.Remove(Stolen);
+
+	if (UAudioComponent* AudioComponent = Cast<UAudioComponent>(Stolen))
+	{
+		AudioComponent->Stop();
+	}
+	else
+	{
+		Stolen->Deactivate();
+	}
+}
+
+uint32 UFeedbackPoolSubsystem::IssueSerial(const USceneComponent* Component)
+{
+	// 0 marks an empty handle
+	if (++LastSerial == 0)
+	{
+		++LastSerial;
+	}
+
+	ComponentSerials.Add(Component, LastSerial);
+	return LastSerial;
+}
+
+bool UFeedbackPoolSubsystem::IsCurrentSerial(const USceneComponent* Component, uint32 Serial) const
+{
+	const uint32* CurrentSerial = ComponentSerials.Find(Component);
+	return Serial != 0 && CurrentSerial && *CurrentSerial == Serial;
+}
+
+UAudioComponent* UFeedbackPoolSubsystem::AcquireAudio(USoundBase* Sound)
+{
+	if (FFeedbackAudioList* FreeList = FreeAudio.Find(Sound))
+	{
+		while (FreeList->Components.Num() > 0)
+		{
+			UAudioComponent* AudioComponent = FreeList->Components.Pop(EAllowShrinking::No);
+			if (IsValid(AudioComponent))
+			{
+				++Stats.Hits;
+				return AudioComponent;
+			}
+		}
+	}
+
+	FAudioDevice::FCreateComponentParams Params(GetWorld());
+	UAudioComponent* AudioComponent = FAudioDevice::CreateComponent(Sound, Params);
+	if (!AudioComponent)
+	{
+		return nullptr;
+	}
+
+	++Stats.Misses;
+	AudioComponent->bAutoDestroy = false;
+	AudioComponent->OnAudioFinishedNative.AddUObject(this, &UFeedbackPoolSubsystem::HandleAudioFinished);
+	AllAudio.Add(AudioComponent);
+
+	return AudioComponent;
+}
+
+void UFeedbackPoolSubsystem::HandleAudioFinished(UAudioComponent* AudioComponent)
+{
+	if (!IsValid(AudioComponent) || !AudioComponent->Sound)
+	{
+		return;
+	}
+
+	ActiveAudio.RemoveAllSwap([AudioComponent](const FActiveFeedback& Entry)
+	{
+		return Entry.Component.Get() == AudioComponent;
+	}, EAllowShrinking::No);
+
+	// Handles to the finished feedback go stale before the component can be reused
+	ComponentSerials.Remove(AudioComponent);
+
+	FreeAudio.FindOrAdd(AudioComponent->Sound).Components.AddUnique(AudioComponent);
+}
+
+UFXSystemComponent* UFeedbackPoolSubsystem::SpawnEffect(UFXSystemAsset* Effect, const FTransform& Transform,
+	bool bForPrewarm)
+{
+	UWorld* World = GetWorld();
+
+	if (UNiagaraSystem* NiagaraSystem = Cast<UNiagaraSystem>(Effect))
+	{
+		return UNiagaraFunctionLibrary::SpawnSystemAtLocation(World, NiagaraSystem, Transform.GetLocation(),
+			Transform.Rotator(), FVector(1.f), false, !bForPrewarm,
+			bForPrewarm ? ENCPoolMethod::ManualRelease : ENCPoolMethod::AutoRelease, !bForPrewarm);
+	}
+
+	if (UParticleSystem* ParticleSystem = Cast<UParticleSystem>(Effect))
+	{
+		return UGameplayStatics::SpawnEmitterAtLocation(World, ParticleSystem, Transform, false,
+			bForPrewarm ? EPSCPoolMethod::ManualRelease : EPSCPoolMethod::AutoRelease, !bForPrewarm);
+	}
+
+	return nullptr;
+}
@@ -0,0 +1,91 @@
+#include "Subsystems/PointSystemCacheSubsystem.h"
+
+#include "Collectables/Artifacts/PointArtifact.h"
+#include "Interfaces/PointSystem.h"
+#include "PlayerStates/SkaterPlayerState.h"
+
+int32 FResolvedPointSystem::AddPoints(int32 Points, FName SourceId) const
+{
+	if (NativeState)
+	{
+		return NativeState->AddPointsWithSource(Points, SourceId);
+	}
+
+	return IPointSystem::Execute_AddPoints(Object, Points);
+}
+
+void UPointSystemCacheSubsystem::Deinitialize()
+{
+	Cache.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UPointSystemCacheSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+FResolvedPointSystem UPointSystemCacheSubsystem::Resolve(AActor* Collector)
+{
+	FResolvedPointSystem Result;
+	if (!Collector)
+	{
+		return Result;
+	}
+
+	if (const FCacheEntry* Entry = Cache.Find(Collector))
+	{
+		if (UObject* Object = Entry->Object.Get())
+		{
+			Result.Object = Object;
+			Result.NativeState = Entry->bNativeAddPoints ? static_cast<ASkaterPlayerState*>(Object) : nullptr;
+			return Result;
+		}
+	}
+
+	IPointSystem* PointSystem = APointArtifact::FindPointSystemInActor(Collector);
+	UObject* Object = Cast<UObject>(PointSystem);
+	if (!Object)
+	{
+		return Result;
+	}
+
+	if (Cache.Num() >= NextPruneSize)
+	{
+		PruneStaleEntries();
+	}
+
+	FCacheEntry& Entry = Cache.Add(Collector);
+	Entry.Object = Object;
+	Entry.bNativeAddPoints = Object->IsA<ASkaterPlayerState>() && HasNativeAddPoints(Object->GetClass());
+
+	Result.Object = Object;
+	Result.NativeState = Entry.bNativeAddPoints ? static_cast<ASkaterPlayerState*>(Object) : nullptr;
+	return Result;
+}
+
+void UPointSystemCacheSubsystem::Invalidate(const AActor* Collector)
+{
+	Cache.Remove(Collector);
+}
+
+bool UPointSystemCacheSubsystem::HasNativeAddPoints(const UClass* Class)
+{
+	// Resolves to the Blueprint function when a Blueprint overrides the event
+	const UFunction* Function = Class->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(IPointSystem, AddPoints));
+	return Function && Function->GetOwnerClass()->HasAnyClassFlags(CLASS_Native);
+}
+
+void UPointSystemCacheSubsystem::PruneStaleEntries()
+{
+	for (auto It = Cache.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid() || !It.Value().Object.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	NextPruneSize = FMath::Max(64, Cache.Num() * 2);
+}
@@ -0,0 +1,388 @@
+#include "Subsystems/SkaterLoadTestSubsystem.h"
+
+#include "Characters/SkaterAICharacter.h"
+#include "Collectables/Artifacts/PointArtifact.h"
+#include "Collectables/DataAssets/ArtifactData.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "GameFramework/PlayerController.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Subsystems/ArtifactPoolSubsystem.h"
+#include "Subsystems/ArtifactRegistrySubsystem.h"
+
+DEFINE_LOG_CATEGORY(LogSkaterLoadTest);
+
+bool USkaterLoadTestSubsystem::IsLoadTestEnabled()
+{
+	return FParse::Param(FCommandLine::Get(), TEXT("SkaterLoadTest"));
+}
+
+bool USkaterLoadTestSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return IsLoadTestEnabled() && Super::ShouldCreateSubsystem(Outer);
+}
+
+bool USkaterLoadTestSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USkaterLoadTestSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	const TCHAR* CommandLine = FCommandLine::Get();
+
+	FParse::Value(CommandLine, TEXT("LoadTestDensity="), ArtifactDensity);
+	FParse::Value(CommandLine, TEXT("LoadTestExtent="), SpawnExtent);
+	FParse::Value(CommandLine, TEXT("LoadTestBots="), BotCount);
+	FParse::Value(CommandLine, TEXT("LoadTestDuration="), Duration);
+
+	if (!FParse::Value(CommandLine, TEXT("LoadTestSeed="), Seed))
+	{
+		Seed = static_cast<int32>(FPlatformProcess::GetCurrentProcessId());
+	}
+
+	const FRandomStream Stream(Seed);
+	ScriptFrequency = Stream.FRandRange(0.05f, 0.25f);
+	ScriptPhase = Stream.FRandRange(0.f, 2.f * PI);
+
+	FString InputPath;
+	if (FParse::Value(CommandLine, TEXT("LoadTestInput="), InputPath) && !RecordedInput.LoadFromFile(InputPath))
+	{
+		UE_LOG(LogSkaterLoadTest, Warning, TEXT("Could not read recorded input '%s', using scripted input"),
+			*InputPath);
+	}
+
+	if (!FParse::Value(CommandLine, TEXT("LoadTestReport="), ReportPath))
+	{
+		ReportPath = FPaths::ProjectSavedDir() / TEXT("LoadTest") /
+			FString::Printf(TEXT("LoadTest_%s.csv"), *FDateTime::Now().ToString());
+	}
+}
+
+void USkaterLoadTestSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	bHasBegunPlay = true;
+
+	if (InWorld.GetNetMode() == NM_Client)
+	{
+		UE_LOG(LogSkaterLoadTest, Log, TEXT("Load test client driving %s input"),
+			RecordedInput.Frames.IsEmpty() ? TEXT("scripted") : TEXT("recorded"));
+		return;
+	}
+
+	if (UArtifactRegistrySubsystem* Registry = InWorld.GetSubsystem<UArtifactRegistrySubsystem>())
+	{
+		CollectedHandle = Registry->OnArtifactCollected.AddUObject(this,
+			&USkaterLoadTestSubsystem::HandleArtifactCollected);
+	}
+
+	ReportRows.Add(TEXT("Time,Connections,Artifacts,Collectors,AvgFrameMs,AvgWorkMs,MaxWorkMs,")
+		TEXT("AvgOutBytesPerConn,MaxOutBytesPerConn,AvgInBytesPerConn,CollectionsPerSec"));
+
+	SpawnArtifacts();
+	SpawnBots();
+}
+
+void USkaterLoadTestSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UArtifactRegistrySubsystem* Registry = World->GetSubsystem<UArtifactRegistrySubsystem>())
+		{
+			Registry->OnArtifactCollected.Remove(CollectedHandle);
+		}
+	}
+
+	WriteReport();
+
+	RecordedInput.Frames.Reset();
+	ReportRows.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId USkaterLoadTestSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USkaterLoadTestSubsystem, STATGROUP_Tickables);
+}
+
+bool USkaterLoadTestSubsystem::IsTickable() const
+{
+	return bHasBegunPlay && !bReportWritten;
+}
+
+void USkaterLoadTestSubsystem::Tick(float DeltaTime)
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	ElapsedTime += DeltaTime;
+
+	if (World->GetNetMode() != NM_DedicatedServer)
+	{
+		DriveLocalSkaters();
+	}
+
+	if (World->GetNetMode() != NM_Client)
+	{
+		// Real frame time; idle time is the sleep spent waiting for the server tick rate
+		const float FrameTime = static_cast<float>(FApp::GetDeltaTime());
+		const float WorkTime = FMath::Max(FrameTime - static_cast<float>(FApp::GetIdleTime()), 0.f);
+
+		SampleFrameTime += FrameTime;
+		SampleWorkTime += WorkTime;
+		SampleMaxWorkTime = FMath::Max(SampleMaxWorkTime, WorkTime);
+		++SampleFrames;
+
+		SampleAccumulator += DeltaTime;
+		if (SampleAccumulator >= SampleInterval)
+		{
+			FlushSample();
+		}
+	}
+
+	if (Duration > 0.f && ElapsedTime >= Duration)
+	{
+		UE_LOG(LogSkaterLoadTest, Log, TEXT("Load test finished after %.1fs, %d collections"), ElapsedTime,
+			TotalCollections);
+
+		WriteReport();
+		FPlatformMisc::RequestExit(false, TEXT("USkaterLoadTestSubsystem::Tick"));
+	}
+}
+
+void USkaterLoadTestSubsystem::SpawnArtifacts()
+{
+	UWorld* World = GetWorld();
+	UArtifactPoolSubsystem* Pool = World->GetSubsystem<UArtifactPoolSubsystem>();
+	if (!Pool)
+	{
+		return;
+	}
+
+	TSubclassOf<APointArtifact> Class = ArtifactClass.LoadSynchronous();
+	if (!Class)
+	{
+		Class = APointArtifact::StaticClass();
+	}
+
+	UArtifactData* Data = ArtifactData.LoadSynchronous();
+	if (!Data)
+	{
+		Data = Class->GetDefaultObject<APointArtifact>()->GetArtifactData();
+	}
+
+	if (!Data)
+	{
+		UE_LOG(LogSkaterLoadTest, Warning, TEXT("No artifact data configured, skipping artifact spawn"));
+		return;
+	}
+
+	// Density is given per 10m x 10m area
+	const float AreaCells = FMath::Square(2.f * SpawnExtent / 1000.f);
+	const int32 Count = FMath::RoundToInt(ArtifactDensity * AreaCells);
+
+	const FRandomStream Stream(Seed);
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		FVector Location;
+		PickGroundLocation(Stream, Location);
+
+		Location.Z += SpawnHeightOffset;
+		Pool->AcquireArtifact(Class, Data, FTransform(Location));
+	}
+
+	UE_LOG(LogSkaterLoadTest, Log, TEXT("Spawned %d artifacts (%.2f per 100m2) over %.0f x %.0f units"), Count,
+		ArtifactDensity, 2.f * SpawnExtent, 2.f * SpawnExtent);
+}
+
+void USkaterLoadTestSubsystem::SpawnBots()
+{
+	if (BotCount <= 0)
+	{
+		return;
+	}
+
+	TSubclassOf<ASkaterCharacterBase> Class = BotClass.LoadSynchronous();
+	if (!Class || Class->HasAnyClassFlags(CLASS_Abstract))
+	{
+		Class = ASkaterAICharacter::StaticClass();
+	}
+
+	UWorld* World = GetWorld();
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	// Separate stream so bot count does not change artifact placement
+	const FRandomStream Stream(Seed + 1);
+
+	int32 Spawned = 0;
+	for (int32 i = 0; i < BotCount; ++i)
+	{
+		FVector Location;
+		PickGroundLocation(Stream, Location);
+
+		// Capsule half height above the ground
+		Location.Z += 100.f;
+		const FRotator Rotation(0.f, Stream.FRandRange(0.f, 360.f), 0.f);
+
+		Spawned += World->SpawnActor<ASkaterCharacterBase>(Class, Location, Rotation, SpawnParams) ? 1 : 0;
+	}
+
+	UE_LOG(LogSkaterLoadTest, Log, TEXT("Spawned %d of %d bot skaters (%s)"), Spawned, BotCount, *Class->GetName());
+}
+
+void USkaterLoadTestSubsystem::PickGroundLocation(const FRandomStream& Stream, FVector& OutLocation) const
+{
+	const float TraceHalfHeight = 50000.f;
+
+	OutLocation = SpawnOrigin + FVector(Stream.FRandRange(-SpawnExtent, SpawnExtent),
+		Stream.FRandRange(-SpawnExtent, SpawnExtent), 0.f);
+
+	FHitResult Hit;
+	if (GetWorld()->LineTraceSingleByChannel(Hit, OutLocation + FVector(0.f, 0.f, TraceHalfHeight),
+		OutLocation - FVector(0.f, 0.f, TraceHalfHeight), ECC_WorldStatic))
+	{
+		OutLocation = Hit.ImpactPoint;
+	}
+}
+
+void USkaterLoadTestSubsystem::DriveLocalSkaters()
+{
+	const bool bReplay = !RecordedInput.Frames.IsEmpty();
+	const FVector2D Input = bReplay ? FVector2D::ZeroVector : SampleScriptedInput(ElapsedTime);
+
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (!PC || !PC->IsLocalController())
+		{
+			continue;
+		}
+
+		ASkaterCharacterBase* Skater = Cast<ASkaterCharacterBase>(PC->GetPawn());
+		if (!Skater)
+		{
+			continue;
+		}
+
+		if (!bReplay)
+		{
+			Skater->SetMovementInput(Input);
+			continue;
+		}
+
+		// Newly possessed pawns pick the replay up; it then runs at the recorder's fixed step
+		USkaterInputRecorderComponent* Recorder = Skater->GetInputRecorder();
+		if (Recorder && !Recorder->IsReplaying())
+		{
+			Recorder->StartReplay(RecordedInput, true);
+		}
+	}
+}
+
+FVector2D USkaterLoadTestSubsystem::SampleScriptedInput(float Time) const
+{
+	const float Steering = 0.8f * FMath::Sin(2.f * PI * ScriptFrequency * Time + ScriptPhase);
+
+	// Brake for 1.5s out of every 10s, accelerate otherwise
+	const float CycleTime = FMath::Fmod(Time + ScriptPhase, 10.f);
+	const float Throttle = CycleTime < 8.5f ? 1.f : -1.f;
+
+	return FVector2D(Steering, Throttle);
+}
+
+void USkaterLoadTestSubsystem::FlushSample()
+{
+	const UWorld* World = GetWorld();
+
+	int32 NumConnections = 0;
+	int64 TotalOutBytes = 0;
+	int64 TotalInBytes = 0;
+	int32 MaxOutBytes = 0;
+
+	if (const UNetDriver* NetDriver = World->GetNetDriver())
+	{
+		for (const UNetConnection* Connection : NetDriver->ClientConnections)
+		{
+			if (!Connection)
+			{
+				continue;
+			}
+
+			++NumConnections;
+			TotalOutBytes += Connection->OutBytesPerSecond;
+			TotalInBytes += Connection->InBytesPerSecond;
+			MaxOutBytes = FMath::Max(MaxOutBytes, Connection->OutBytesPerSecond);
+		}
+	}
+
+	int32 NumArtifacts = 0;
+	int32 NumCollectors = 0;
+	if (const UArtifactRegistrySubsystem* Registry = World->GetSubsystem<UArtifactRegistrySubsystem>())
+	{
+		NumArtifacts = Registry->GetNumArtifacts();
+		NumCollectors = Registry->GetNumCollectors();
+	}
+
+	const double Frames = FMath::Max(SampleFrames, 1);
+	const double Connections = FMath::Max(NumConnections, 1);
+
+	ReportRows.Add(FString::Printf(TEXT("%.2f,%d,%d,%d,%.3f,%.3f,%.3f,%.1f,%d,%.1f,%.2f"),
+		ElapsedTime,
+		NumConnections,
+		NumArtifacts,
+		NumCollectors,
+		SampleFrameTime / Frames * 1000.0,
+		SampleWorkTime / Frames * 1000.0,
+		SampleMaxWorkTime * 1000.f,
+		TotalOutBytes / Connections,
+		MaxOutBytes,
+		TotalInBytes / Connections,
+		SampleCollections / SampleAccumulator));
+
+	SampleAccumulator = 0.f;
+	SampleFrameTime = 0.0;
+	SampleWorkTime = 0.0;
+	SampleMaxWorkTime = 0.f;
+	SampleFrames = 0;
+	SampleCollections = 0;
+}
+
+void USkaterLoadTestSubsystem::WriteReport()
+{
+	// Only the server collects rows; the header alone is not worth a file
+	if (bReportWritten || ReportRows.Num() <= 1)
+	{
+		return;
+	}
+
+	bReportWritten = true;
+
+	if (FFileHelper::SaveStringArrayToFile(ReportRows, *ReportPath))
+	{
+		UE_LOG(LogSkaterLoadTest, Log, TEXT("Load test report written to %s"), *ReportPath);
+	}
+	else
+	{
+		UE_LOG(LogSkaterLoadTest, Error, TEXT("Failed to write load test report to %s"), *ReportPath);
+	}
+}
+
+void USkaterLoadTestSubsystem::HandleArtifactCollected(AActor* Collectable, ASkaterCharacterBase* Collector)
+{
+	++SampleCollections;
+	++TotalCollections;
+}
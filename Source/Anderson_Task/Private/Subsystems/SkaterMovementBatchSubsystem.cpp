@@ -0,0 +1,188 @@
+#include "Subsystems/SkaterMovementBatchSubsystem.h"
+
+#include "Async/ParallelFor.h"
+#include "Components/SkaterMovementComponent.h"
+#include "Profiling/SkaterStats.h"
+#include "Profiling/SkaterTrace.h"
+
+void USkaterMovementBatchSubsystem::Deinitialize()
+{
+	Inputs.Reset();
+	TurnValues.Reset();
+	TurnRates.Reset();
+	SteeringInterpSpeeds.Reset();
+	YawDeltas.Reset();
+	States.Reset();
+	Skaters.Reset();
+	MovementComponents.Reset();
+	DenseToHandle.Reset();
+	HandleToDense.Reset();
+	FreeHandles.Reset();
+
+	Super::Deinitialize();
+}
+
+bool USkaterMovementBatchSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId USkaterMovementBatchSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USkaterMovementBatchSubsystem, STATGROUP_Tickables);
+}
+
+bool USkaterMovementBatchSubsystem::IsTickable() const
+{
+	return Inputs.Num() > 0;
+}
+
+void USkaterMovementBatchSubsystem::Tick(float DeltaTime)
+{
+	UpdateSkaters(DeltaTime);
+}
+
+int32 USkaterMovementBatchSubsystem::RegisterSkater(ASkaterCharacterBase* Skater)
+{
+	USkaterMovementComponent* CMC = Skater ? Cast<USkaterMovementComponent>(Skater->GetCharacterMovement()) : nullptr;
+	if (!CMC)
+	{
+		return INDEX_NONE;
+	}
+
+	int32 Handle;
+	if (FreeHandles.Num() > 0)
+	{
+		Handle = FreeHandles.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		Handle = HandleToDense.Add(INDEX_NONE);
+	}
+
+	HandleToDense[Handle] = Inputs.Num();
+	DenseToHandle.Add(Handle);
+
+	Inputs.Add(FVector2D::ZeroVector);
+	TurnValues.Add(0.f);
+	TurnRates.Add(CMC->TurnRate);
+	SteeringInterpSpeeds.Add(CMC->SteeringInterpSpeed);
+	YawDeltas.Add(0.f);
+	States.Add(Skater->CurrentMovementState);
+	Skaters.Add(Skater);
+	MovementComponents.Add(CMC);
+
+	Skater->SetActorTickEnabled(false);
+	CMC->SetSteeringDrivenExternally(true);
+
+	return Handle;
+}
+
+void USkaterMovementBatchSubsystem::UnregisterSkater(int32 Handle)
+{
+	if (!HandleToDense.IsValidIndex(Handle) || HandleToDense[Handle] == INDEX_NONE)
+	{
+		return;
+	}
+
+	const int32 DenseIndex = HandleToDense[Handle];
+
+	if (ASkaterCharacterBase* Skater = Skaters[DenseIndex].Get())
+	{
+		Skater->SetActorTickEnabled(true);
+	}
+
+	if (USkaterMovementComponent* CMC = MovementComponents[DenseIndex].Get())
+	{
+		CMC->SetSteeringDrivenExternally(false);
+	}
+
+	Inputs.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	TurnValues.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	TurnRates.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	SteeringInterpSpeeds.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	YawDeltas.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	States.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	Skaters.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	MovementComponents.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	DenseToHandle.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+
+	// The last entry moved into the freed slot
+	if (DenseToHandle.IsValidIndex(DenseIndex))
+	{
+		HandleToDense[DenseToHandle[DenseIndex]] = DenseIndex;
+	}
+
+	HandleToDense[Handle] = INDEX_NONE;
+	FreeHandles.Add(Handle);
+}
+
+void USkaterMovementBatchSubsystem::SetInput(int32 Handle, const FVector2D& Input)
+{
+	if (HandleToDense.IsValidIndex(Handle) && HandleToDense[Handle] != INDEX_NONE)
+	{
+		Inputs[HandleToDense[Handle]] = Input;
+	}
+}
+
+void USkaterMovementBatchSubsystem::UpdateSkaters(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SkaterBatchedSteering);
+
+	const int32 NumSkaters = Inputs.Num();
+	if (NumSkaters == 0 || DeltaTime <= 0.f)
+	{
+		return;
+	}
+
+	// Pure math over the packed arrays; no UObject access off the game thread
+	ParallelFor(TEXT("SkaterSteering"), NumSkaters, MinBatchSize, [this, DeltaTime](int32 Index)
+	{
+		const FVector2D Input = Inputs[Index];
+
+		TurnValues[Index] = USkaterMovementComponent::StepTurnValue(TurnValues[Index],
+			USkaterMovementComponent::GetTargetTurn(Input), DeltaTime, SteeringInterpSpeeds[Index]);
+
+		YawDeltas[Index] = FMath::Abs(TurnValues[Index]) > USkaterMovementComponent::TurnDeadzone
+			? TurnValues[Index] * TurnRates[Index] * DeltaTime
+			: 0.f;
+
+		if (Input.Y > USkaterMovementComponent::InputDeadzone)
+		{
+			States[Index] = ESkaterMovementState::Accelerating;
+		}
+		else if (Input.Y < -USkaterMovementComponent::InputDeadzone)
+		{
+			States[Index] = ESkaterMovementState::Braking;
+		}
+		else
+		{
+			States[Index] = ESkaterMovementState::Coasting;
+		}
+	});
+
+	for (int32 Index = 0; Index < NumSkaters; ++Index)
+	{
+		ASkaterCharacterBase* Skater = Skaters[Index].Get();
+		USkaterMovementComponent* CMC = MovementComponents[Index].Get();
+		if (!Skater || !CMC)
+		{
+			continue;
+		}
+
+		const FVector2D& Input = Inputs[Index];
+		CMC->SetSkateInput(Input);
+		CMC->ApplyExternalSteering(TurnValues[Index], YawDeltas[Index]);
+
+		if (Input.Y > USkaterMovementComponent::InputDeadzone)
+		{
+			Skater->AddMovementInput(Skater->GetActorForwardVector(), Input.Y);
+		}
+
+		if (Skater->CurrentMovementState != States[Index])
+		{
+			SKATER_TRACE_MOVEMENT_STATE(Skater, Skater->CurrentMovementState, States[Index]);
+			Skater->CurrentMovementState = States[Index];
+		}
+	}
+}
@@ -0,0 +1,221 @@
+#include "Subsystems/SkaterSignificanceSubsystem.h"
+
+#include "Characters/SkaterCharacterBase.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "SignificanceManager.h"
+
+namespace SkaterSignificance
+{
+	const FName Tag(TEXT("Skater"));
+}
+
+USkaterSignificanceSubsystem::USkaterSignificanceSubsystem()
+{
+	MediumSettings.ActorTickInterval = 1.f / 30.f;
+	MediumSettings.MeshTickInterval = 1.f / 30.f;
+	MediumSettings.SmoothingMode = ENetworkSmoothingMode::Linear;
+
+	LowSettings.ActorTickInterval = 0.1f;
+	LowSettings.MeshTickInterval = 0.1f;
+	LowSettings.bCastShadows = false;
+	LowSettings.SmoothingMode = ENetworkSmoothingMode::Disabled;
+
+	OffSettings.ActorTickInterval = 0.25f;
+	OffSettings.MeshTickInterval = 0.5f;
+	OffSettings.bCastShadows = false;
+	OffSettings.SmoothingMode = ENetworkSmoothingMode::Disabled;
+}
+
+void USkaterSignificanceSubsystem::Deinitialize()
+{
+	if (USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld()))
+	{
+		SignificanceManager->UnregisterAll(SkaterSignificance::Tag);
+	}
+
+	AppliedSignificance.Reset();
+	Viewpoints.Reset();
+
+	Super::Deinitialize();
+}
+
+bool USkaterSignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId USkaterSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USkaterSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+bool USkaterSignificanceSubsystem::IsTickable() const
+{
+	return AppliedSignificance.Num() > 0;
+}
+
+void USkaterSignificanceSubsystem::Tick(float DeltaTime)
+{
+	UpdateAccumulator += DeltaTime;
+	if (UpdateAccumulator < UpdateInterval)
+	{
+		return;
+	}
+	UpdateAccumulator = 0.f;
+
+	USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld());
+	if (!SignificanceManager)
+	{
+		return;
+	}
+
+	Viewpoints.Reset();
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (!PC || !PC->IsLocalController())
+		{
+			continue;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+		Viewpoints.Emplace(ViewRotation, ViewLocation);
+	}
+
+	SignificanceManager->Update(Viewpoints);
+}
+
+void USkaterSignificanceSubsystem::RegisterSkater(ASkaterCharacterBase* Skater)
+{
+	const UWorld* World = GetWorld();
+	if (!Skater || !World || World->GetNetMode() == NM_DedicatedServer || AppliedSignificance.Contains(Skater))
+	{
+		return;
+	}
+
+	USignificanceManager* SignificanceManager = USignificanceManager::Get(World);
+	if (!SignificanceManager)
+	{
+		return;
+	}
+
+	// Skaters start at full cost
+	AppliedSignificance.Add(Skater, ESkaterSignificance::High);
+
+	SignificanceManager->RegisterObject(Skater, SkaterSignificance::Tag,
+		[this](USignificanceManager::FManagedObjectInfo* Info, const FTransform& Viewpoint)
+		{
+			return CalculateSignificance(CastChecked<ASkaterCharacterBase>(Info->GetObject()), Viewpoint);
+		},
+		USignificanceManager::EPostSignificanceType::Sequential,
+		[this](USignificanceManager::FManagedObjectInfo* Info, float OldSignificance, float Significance, bool bFinal)
+		{
+			// Unregistered objects get a final call; restore full cost
+			ApplySignificance(CastChecked<ASkaterCharacterBase>(Info->GetObject()),
+				bFinal ? ESkaterSignificance::High : static_cast<ESkaterSignificance>(FMath::RoundToInt32(Significance)));
+		});
+}
+
+void USkaterSignificanceSubsystem::UnregisterSkater(ASkaterCharacterBase* Skater)
+{
+	if (!Skater || !AppliedSignificance.Contains(Skater))
+	{
+		return;
+	}
+
+	if (USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld()))
+	{
+		SignificanceManager->UnregisterObject(Skater);
+	}
+
+	AppliedSignificance.Remove(Skater);
+}
+
+ESkaterSignificance USkaterSignificanceSubsystem::GetSignificance(const ASkaterCharacterBase* Skater) const
+{
+	const ESkaterSignificance* Significance = AppliedSignificance.Find(Skater);
+	return Significance ? *Significance : ESkaterSignificance::High;
+}
+
+float USkaterSignificanceSubsystem::CalculateSignificance(const ASkaterCharacterBase* Skater,
+	const FTransform& Viewpoint) const
+{
+	if (Skater->IsLocallyControlled())
+	{
+		return static_cast<float>(ESkaterSignificance::High);
+	}
+
+	const float DistanceSq = FVector::DistSquared(Skater->GetActorLocation(), Viewpoint.GetLocation());
+	const bool bOnScreen = Skater->WasRecentlyRendered(RecentlyRenderedTolerance);
+
+	// Off-screen skaters drop one bucket; past LowDistance they are Off either way
+	ESkaterSignificance Significance = ESkaterSignificance::Off;
+	if (DistanceSq <= FMath::Square(HighDistance))
+	{
+		Significance = bOnScreen ? ESkaterSignificance::High : ESkaterSignificance::Medium;
+	}
+	else if (DistanceSq <= FMath::Square(MediumDistance))
+	{
+		Significance = bOnScreen ? ESkaterSignificance::Medium : ESkaterSignificance::Low;
+	}
+	else if (DistanceSq <= FMath::Square(LowDistance))
+	{
+		Significance = bOnScreen ? ESkaterSignificance::Low : ESkaterSignificance::Off;
+	}
+
+	return static_cast<float>(Significance);
+}
+
+void USkaterSignificanceSubsystem::ApplySignificance(ASkaterCharacterBase* Skater, ESkaterSignificance Significance)
+{
+	ESkaterSignificance* Applied = AppliedSignificance.Find(Skater);
+	if (!Applied || *Applied == Significance)
+	{
+		return;
+	}
+	*Applied = Significance;
+
+	const FSkaterSignificanceSettings& Settings = GetSettings(Significance);
+
+	Skater->SetActorTickInterval(Settings.ActorTickInterval);
+
+	if (USkeletalMeshComponent* Mesh = Skater->GetMesh())
+	{
+		Mesh->SetComponentTickInterval(Settings.MeshTickInterval);
+		Mesh->SetCastShadow(Settings.bCastShadows);
+	}
+
+	if (UStaticMeshComponent* SkateboardMesh = Skater->GetSkateboardMesh())
+	{
+		SkateboardMesh->SetCastShadow(Settings.bCastShadows);
+	}
+
+	// Steering of simulated proxies is not simulated; what remains is smoothing between updates
+	if (Skater->GetLocalRole() == ROLE_SimulatedProxy)
+	{
+		if (UCharacterMovementComponent* CMC = Skater->GetCharacterMovement())
+		{
+			CMC->NetworkSmoothingMode = Settings.SmoothingMode;
+		}
+	}
+}
+
+const FSkaterSignificanceSettings& USkaterSignificanceSubsystem::GetSettings(ESkaterSignificance Significance) const
+{
+	switch (Significance)
+	{
+	case ESkaterSignificance::Off:
+		return OffSettings;
+	case ESkaterSignificance::Low:
+		return LowSettings;
+	case ESkaterSignificance::Medium:
+		return MediumSettings;
+	default:
+		return HighSettings;
+	}
+}
@@ -0,0 +1,283 @@
+#include "Subsystems/SkaterTelemetrySubsystem.h"
+
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Profiling/SkaterCsvProfiler.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Subsystems/ArtifactRegistrySubsystem.h"
+#include "Subsystems/FeedbackPoolSubsystem.h"
+
+DEFINE_LOG_CATEGORY(LogSkaterTelemetry);
+
+namespace SkaterTelemetry
+{
+	void WriteLine(FArchive& Ar, const FString& Line)
+	{
+		const FTCHARToUTF8 Utf8(*(Line + LINE_TERMINATOR));
+		Ar.Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+	}
+}
+
+bool USkaterTelemetrySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USkaterTelemetrySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	bHasBegunPlay = true;
+
+	if (UArtifactRegistrySubsystem* Registry = InWorld.GetSubsystem<UArtifactRegistrySubsystem>())
+	{
+		CollectedHandle = Registry->OnArtifactCollected.AddUObject(this,
+			&USkaterTelemetrySubsystem::HandleArtifactCollected);
+	}
+}
+
+void USkaterTelemetrySubsystem::Deinitialize()
+{
+	EndSession();
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UArtifactRegistrySubsystem* Registry = World->GetSubsystem<UArtifactRegistrySubsystem>())
+		{
+			Registry->OnArtifactCollected.Remove(CollectedHandle);
+		}
+	}
+
+	Super::Deinitialize();
+}
+
+TStatId USkaterTelemetrySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USkaterTelemetrySubsystem, STATGROUP_Tickables);
+}
+
+bool USkaterTelemetrySubsystem::IsTickable() const
+{
+	return bHasBegunPlay;
+}
+
+void USkaterTelemetrySubsystem::Tick(float DeltaTime)
+{
+	GatherFrame();
+
+	// Points commit at end of frame, after this tick, so broadcasts land in the following frame
+	CSV_CUSTOM_STAT(Skater, ActiveSkaters, CurrentFrame.ActiveSkaters, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(Skater, PointsBroadcasts, CurrentFrame.PointsBroadcasts, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SkaterArtifacts, ArtifactsAlive, CurrentFrame.ArtifactsAlive, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SkaterArtifacts, Collections, CurrentFrame.Collections, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SkaterArtifacts, FeedbackLive, CurrentFrame.FeedbackLive, ECsvCustomStatOp::Set);
+
+	if (bSessionActive)
+	{
+		AccumulateFrame(static_cast<float>(FApp::GetDeltaTime()));
+
+		SampleAccumulator += DeltaTime;
+		if (SampleAccumulator >= SampleInterval)
+		{
+			FlushSample();
+		}
+	}
+
+	CurrentFrame = FSkaterTelemetryFrame();
+}
+
+void USkaterTelemetrySubsystem::GatherFrame()
+{
+	const UWorld* World = GetWorld();
+
+	if (const UArtifactRegistrySubsystem* Registry = World->GetSubsystem<UArtifactRegistrySubsystem>())
+	{
+		CurrentFrame.ActiveSkaters = Registry->GetNumCollectors();
+		CurrentFrame.ArtifactsAlive = Registry->GetNumArtifacts();
+	}
+
+	if (const UFeedbackPoolSubsystem* FeedbackPool = World->GetSubsystem<UFeedbackPoolSubsystem>())
+	{
+		CurrentFrame.FeedbackLive = FeedbackPool->GetNumLiveComponents();
+	}
+}
+
+void USkaterTelemetrySubsystem::AccumulateFrame(float FrameTime)
+{
+	SessionFrameTime += FrameTime;
+	SessionMaxFrameTime = FMath::Max(SessionMaxFrameTime, FrameTime);
+	SessionSkaterFrames += CurrentFrame.ActiveSkaters;
+	SessionCollections += CurrentFrame.Collections;
+	SessionPointsBroadcasts += CurrentFrame.PointsBroadcasts;
+	++SessionFrames;
+
+	PeakSkaters = FMath::Max(PeakSkaters, CurrentFrame.ActiveSkaters);
+	PeakArtifacts = FMath::Max(PeakArtifacts, CurrentFrame.ArtifactsAlive);
+	PeakFeedbackLive = FMath::Max(PeakFeedbackLive, CurrentFrame.FeedbackLive);
+
+	SampleFrameTime += FrameTime;
+	SampleSkaters += CurrentFrame.ActiveSkaters;
+	SampleArtifacts += CurrentFrame.ArtifactsAlive;
+	SampleFeedbackLive += CurrentFrame.FeedbackLive;
+	SampleCollections += CurrentFrame.Collections;
+	SamplePointsBroadcasts += CurrentFrame.PointsBroadcasts;
+	++SampleFrames;
+}
+
+void USkaterTelemetrySubsystem::BeginSession(const FString& InSessionName)
+{
+	if (bSessionActive)
+	{
+		return;
+	}
+
+	bSessionActive = true;
+	SessionName = InSessionName;
+	SessionStartTime = FPlatformTime::Seconds();
+
+	SessionFrameTime = 0.0;
+	SessionMaxFrameTime = 0.f;
+	SessionFrames = 0;
+	SessionSkaterFrames = 0;
+	SessionCollections = 0;
+	SessionPointsBroadcasts = 0;
+	PeakSkaters = 0;
+	PeakArtifacts = 0;
+	PeakFeedbackLive = 0;
+
+	if (bWriteTelemetryFile)
+	{
+		const FString Directory = FPaths::ProjectSavedDir() / TEXT("Telemetry");
+		const FString SinkPath = Directory / SessionName + TEXT(".csv");
+		SummaryPath = Directory / SessionName + TEXT("_Summary.json");
+
+		SinkWriter.Reset(IFileManager::Get().CreateFileWriter(*SinkPath));
+		if (SinkWriter)
+		{
+			SkaterTelemetry::WriteLine(*SinkWriter, TEXT("Time,Frames,AvgFrameMs,AvgSkaters,AvgArtifacts,")
+				TEXT("AvgFeedbackLive,CollectionsPerSec,PointsBroadcastsPerSec"));
+		}
+		else
+		{
+			UE_LOG(LogSkaterTelemetry, Error, TEXT("Failed to open telemetry file %s"), *SinkPath);
+		}
+	}
+
+#if CSV_PROFILER
+	FCsvProfiler* CsvProfiler = FCsvProfiler::Get();
+	const bool bWantsCapture = bCaptureCsvProfile || FParse::Param(FCommandLine::Get(), TEXT("SkaterCsvCapture"));
+	if (bWantsCapture && !CsvProfiler->IsCapturing())
+	{
+		CsvProfiler->BeginCapture(-1, FString(), SessionName + TEXT(".csv"));
+		bOwnsCsvCapture = true;
+	}
+
+	CSV_METADATA(TEXT("SkaterSession"), *SessionName);
+#endif
+
+	UE_LOG(LogSkaterTelemetry, Log, TEXT("Telemetry session %s started"), *SessionName);
+}
+
+void USkaterTelemetrySubsystem::EndSession()
+{
+	if (!bSessionActive)
+	{
+		return;
+	}
+
+	if (SampleFrames > 0)
+	{
+		FlushSample();
+	}
+
+	bSessionActive = false;
+
+	if (SinkWriter)
+	{
+		SinkWriter->Close();
+		SinkWriter.Reset();
+
+		WriteSummary();
+	}
+
+#if CSV_PROFILER
+	if (bOwnsCsvCapture)
+	{
+		FCsvProfiler::Get()->EndCapture();
+		bOwnsCsvCapture = false;
+	}
+#endif
+
+	UE_LOG(LogSkaterTelemetry, Log, TEXT("Telemetry session %s ended after %lld frames"), *SessionName,
+		SessionFrames);
+}
+
+void USkaterTelemetrySubsystem::FlushSample()
+{
+	if (SinkWriter)
+	{
+		const double Frames = FMath::Max(SampleFrames, 1);
+		const double Seconds = FMath::Max(SampleAccumulator, UE_SMALL_NUMBER);
+
+		SkaterTelemetry::WriteLine(*SinkWriter, FString::Printf(TEXT("%.2f,%d,%.3f,%.1f,%.1f,%.1f,%.2f,%.2f"),
+			FPlatformTime::Seconds() - SessionStartTime,
+			SampleFrames,
+			SampleFrameTime / Frames * 1000.0,
+			SampleSkaters / Frames,
+			SampleArtifacts / Frames,
+			SampleFeedbackLive / Frames,
+			SampleCollections / Seconds,
+			SamplePointsBroadcasts / Seconds));
+	}
+
+	SampleAccumulator = 0.f;
+	SampleFrameTime = 0.0;
+	SampleSkaters = 0;
+	SampleArtifacts = 0;
+	SampleFeedbackLive = 0;
+	SampleCollections = 0;
+	SamplePointsBroadcasts = 0;
+	SampleFrames = 0;
+}
+
+void USkaterTelemetrySubsystem::WriteSummary() const
+{
+	const double Frames = FMath::Max<int64>(SessionFrames, 1);
+	const double Duration = FPlatformTime::Seconds() - SessionStartTime;
+
+	TSharedRef<FJsonObject> Summary = MakeShared<FJsonObject>();
+	Summary->SetStringField(TEXT("Session"), SessionName);
+	Summary->SetStringField(TEXT("NetMode"), GetWorld()->GetNetMode() == NM_DedicatedServer
+		? TEXT("DedicatedServer") : TEXT("Game"));
+	Summary->SetNumberField(TEXT("DurationSeconds"), Duration);
+	Summary->SetNumberField(TEXT("Frames"), static_cast<double>(SessionFrames));
+	Summary->SetNumberField(TEXT("AvgFrameMs"), SessionFrameTime / Frames * 1000.0);
+	Summary->SetNumberField(TEXT("MaxFrameMs"), SessionMaxFrameTime * 1000.f);
+	Summary->SetNumberField(TEXT("AvgSkaters"), SessionSkaterFrames / Frames);
+	Summary->SetNumberField(TEXT("PeakSkaters"), PeakSkaters);
+	Summary->SetNumberField(TEXT("PeakArtifacts"), PeakArtifacts);
+	Summary->SetNumberField(TEXT("PeakFeedbackLive"), PeakFeedbackLive);
+	Summary->SetNumberField(TEXT("Collections"), static_cast<double>(SessionCollections));
+	Summary->SetNumberField(TEXT("PointsBroadcasts"), static_cast<double>(SessionPointsBroadcasts));
+
+	FString Output;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	if (FJsonSerializer::Serialize(Summary, Writer) && FFileHelper::SaveStringToFile(Output, *SummaryPath))
+	{
+		UE_LOG(LogSkaterTelemetry, Log, TEXT("Telemetry summary written to %s"), *SummaryPath);
+	}
+	else
+	{
+		UE_LOG(LogSkaterTelemetry, Error, TEXT("Failed to write telemetry summary to %s"), *SummaryPath);
+	}
+}
+
+void USkaterTelemetrySubsystem::HandleArtifactCollected(AActor* Collectable, ASkaterCharacterBase* Collector)
+{
+	++CurrentFrame.Collections;
+}
@@ -1,6 +1,9 @@
 #include "UI/SkaterHUD.h"
+#include "Components/RetainerBox.h"
 #include "Components/TextBlock.h"
+#include "GameStates/SkaterGameState.h"
 #include "PlayerStates/SkaterPlayerState.h"
+#include "Profiling/SkaterStats.h"
 #include "Characters/SkaterCharacterBase.h"
 
 void USkaterHUD::NativeConstruct()
@@ -13,6 +16,7 @@ void USkaterHUD::NativeConstruct()
     if (!SpeedText)
         UE_LOG(LogTemp, Error, TEXT("SkaterHUD::NativeConstruct - SpeedText is NULL! Check Widget Blueprint binding"));
 
+    BuildSpeedTextCache();
 
     const APlayerController* PC = GetOwningPlayer();
     if (!PC)
@@ -39,10 +43,13 @@ void USkaterHUD::NativeConstruct()
     CachedPlayerState = PS;
 
     BindToPlayerState();
+    BindToLeaderboard();
 }
 
 void USkaterHUD::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
 {
+    SCOPE_CYCLE_COUNTER(STAT_SkaterHUDTick);
+
     Super::NativeTick(MyGeometry, InDeltaTime);
 
     if (!CachedPlayerCharacter.IsValid())
@@ -68,30 +75,134 @@ void USkaterHUD::OnPointsChangedHandler(int32 OldPoints, int32 NewPoints, int32
     UpdatePoints(NewPoints);
 }
 
-void USkaterHUD::UpdatePoints(int32 NewPoints) const
+void USkaterHUD::BindToLeaderboard()
 {
-    if (!PointsText)
+    if (!RankText)
+        return;
+
+    UWorld* World = GetWorld();
+    if (!World)
+        return;
+
+    // Clients construct the HUD before the game state may have replicated
+    AGameStateBase* GameStateBase = World->GetGameState();
+    if (!GameStateBase)
+    {
+        if (!GameStateSetHandle.IsValid())
+            GameStateSetHandle = World->GameStateSetEvent.AddUObject(this, &USkaterHUD::HandleGameStateSet);
+        return;
+    }
+
+    ASkaterGameState* GameState = Cast<ASkaterGameState>(GameStateBase);
+    if (!GameState)
     {
+        UE_LOG(LogTemp, Warning, TEXT("SkaterHUD::BindToLeaderboard - GameState is not a SkaterGameState"));
         return;
     }
 
+    if (CachedGameState.Get() == GameState)
+        return;
+
+    CachedGameState = GameState;
+    GameState->OnLeaderboardChanged.AddUObject(this, &USkaterHUD::UpdateRank);
+    UpdateRank();
+}
+
+void USkaterHUD::HandleGameStateSet(AGameStateBase* GameState)
+{
+    if (UWorld* World = GetWorld())
+        World->GameStateSetEvent.Remove(GameStateSetHandle);
+
+    GameStateSetHandle.Reset();
+    BindToLeaderboard();
+}
+
+void USkaterHUD::UpdateRank()
+{
+    if (!RankText || !CachedGameState.IsValid() || !CachedPlayerState.IsValid())
+        return;
+
+    const int32 Rank = CachedGameState->GetRank(CachedPlayerState.Get());
+    const int32 NumRanked = CachedGameState->GetNumRanked();
+    if (Rank == DisplayedRank && NumRanked == DisplayedNumRanked)
+        return;
+
+    DisplayedRank = Rank;
+    DisplayedNumRanked = NumRanked;
+
+    FFormatNamedArguments Args;
+    Args.Add(TEXT("0"), Rank);
+    Args.Add(TEXT("1"), NumRanked);
+    RankText->SetText(FText::Format(RankFormat, Args));
+
+    RequestRetainerRender();
+}
+
+void USkaterHUD::UpdatePoints(int32 NewPoints)
+{
+    if (!PointsText || NewPoints == DisplayedPoints)
+    {
+        return;
+    }
+
+    DisplayedPoints = NewPoints;
+
     FFormatNamedArguments Args;
     Args.Add(TEXT("0"), NewPoints);
-    const FText FormattedText = FText::Format(PointsFormat, Args);
-    PointsText->SetText(FormattedText);
+    PointsText->SetText(FText::Format(PointsFormat, Args));
 
+    RequestRetainerRender();
 }
 
-void USkaterHUD::UpdateSpeed(float SpeedPercent) const
+void USkaterHUD::UpdateSpeed(float SpeedPercent)
 {
     if (!SpeedText)
     {
         return;
     }
 
-    const int32 SpeedInt = FMath::RoundToInt(SpeedPercent * 100.f);
-    FFormatNamedArguments Args;
-    Args.Add(TEXT("0"), SpeedInt);
-    const FText FormattedText = FText::Format(SpeedFormat, Args);
-    SpeedText->SetText(FormattedText);
+    const int32 Step = FMath::Max(SpeedStep, 1);
+    const int32 SpeedInt = FMath::Clamp(FMath::RoundToInt(SpeedPercent * 100.f / Step) * Step, 0, 100);
+    if (SpeedInt == DisplayedSpeed)
+    {
+        return;
+    }
+
+    DisplayedSpeed = SpeedInt;
+
+    const int32 CacheIndex = SpeedInt / Step;
+    if (SpeedTextCache.IsValidIndex(CacheIndex))
+    {
+        SpeedText->SetText(SpeedTextCache[CacheIndex]);
+    }
+    else
+    {
+        FFormatNamedArguments Args;
+        Args.Add(TEXT("0"), SpeedInt);
+        SpeedText->SetText(FText::Format(SpeedFormat, Args));
+    }
+
+    RequestRetainerRender();
+}
+
+void USkaterHUD::BuildSpeedTextCache()
+{
+    const int32 Step = FMath::Max(SpeedStep, 1);
+
+    SpeedTextCache.Reset(100 / Step + 1);
+    for (int32 Percent = 0; Percent <= 100; Percent += Step)
+    {
+        FFormatNamedArguments Args;
+        Args.Add(TEXT("0"), Percent);
+        SpeedTextCache.Add(FText::Format(SpeedFormat, Args));
+    }
+
+    // Force the next update through with the fresh texts
+    DisplayedSpeed = INDEX_NONE;
+}
+
+void USkaterHUD::RequestRetainerRender() const
+{
+    if (HUDRetainer)
+        HUDRetainer->RequestRender();
 }
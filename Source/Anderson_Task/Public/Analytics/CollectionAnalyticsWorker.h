@@ -0,0 +1,234 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "HAL/Runnable.h"
+
+#include <atomic>
+
+class FRunnableThread;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogCollectionAnalytics, Log, All);
+
+/**
+ * Record types stored in the binary log, each written as a block of records of one type.
+ */
+enum class ESkaterAnalyticsRecord : uint8
+{
+	Collection,
+	MovementSample,
+	Placement
+};
+
+/**
+ * One collection, as pushed by the game thread and stored in the binary log (28 bytes).
+ */
+struct FSkaterCollectionEvent
+{
+	// PlayerId of the collector's player state, 0 if none
+	uint32 CollectorId = 0;
+
+	// CRC32 of the artifact data's primary asset ID string
+	uint32 ArtifactDataId = 0;
+
+	FVector3f Location = FVector3f::ZeroVector;
+
+	// World time of the collection in seconds
+	float Time = 0.f;
+
+	int32 Points = 0;
+
+	friend FArchive& operator<<(FArchive& Ar, FSkaterCollectionEvent& Event);
+};
+
+/**
+ * Position of one skater at a sample tick (20 bytes).
+ */
+struct FSkaterMovementSample
+{
+	// PlayerId of the skater's player state, 0 if none
+	uint32 SkaterId = 0;
+
+	FVector3f Location = FVector3f::ZeroVector;
+
+	float Time = 0.f;
+
+	friend FArchive& operator<<(FArchive& Ar, FSkaterMovementSample& Sample);
+};
+
+/**
+ * An artifact becoming collectable at a location, once per spawn or reuse (20 bytes).
+ */
+struct FSkaterArtifactPlacement
+{
+	// CRC32 of the artifact data's primary asset ID string
+	uint32 ArtifactDataId = 0;
+
+	FVector3f Location = FVector3f::ZeroVector;
+
+	float Time = 0.f;
+
+	friend FArchive& operator<<(FArchive& Ar, FSkaterArtifactPlacement& Placement);
+};
+
+/**
+ * Aggregated collection statistics copied out of the worker.
+ */
+struct FCollectionAnalyticsSnapshot
+{
+	// Edge length of one heatmap cell in world units
+	float CellSize = 0.f;
+
+	// Collections per XY cell
+	TMap<FIntPoint, uint32> CellCounts;
+
+	// Movement samples per XY cell; multiply by the sample interval for dwell time
+	TMap<FIntPoint, uint32> CellSamples;
+
+	// Artifact placements per XY cell
+	TMap<FIntPoint, uint32> CellPlacements;
+
+	uint64 TotalEvents = 0;
+
+	int64 TotalPoints = 0;
+
+	// World time of the first and last aggregated collection
+	float FirstTime = 0.f;
+
+	float LastTime = 0.f;
+};
+
+/**
+ * Settings handed to the worker at start.
+ */
+struct FCollectionAnalyticsSettings
+{
+	// Directory receiving the log files
+	FString LogDirectory;
+
+	// File name prefix; files are <Prefix>_<Index>.bin
+	FString LogPrefix;
+
+	// Bytes per log file before rolling to the next
+	int64 MaxFileBytes = 16 * 1024 * 1024;
+
+	// Log files kept on disk; older ones are deleted
+	int32 MaxFiles = 8;
+
+	// Heatmap cell size in world units
+	float CellSize = 1000.f;
+
+	// Seconds between movement samples, stored in the log header
+	float SampleInterval = 0.5f;
+
+	// Milliseconds between queue drains
+	uint32 DrainIntervalMs = 250;
+};
+
+/**
+ * @brief Background worker draining analytics records into aggregates and a rolling binary log.
+ * @details Producers push into lock-free MPSC queues and never wait or signal; the worker wakes
+ * every DrainIntervalMs, aggregates the drained records per heatmap cell and appends them to the
+ * current log file, rolling to a new file past MaxFileBytes.
+ *
+ * Each file starts with the magic "SKCE", a uint16 version, the cell size and the sample interval.
+ * Records follow in blocks: a uint8 ESkaterAnalyticsRecord, a uint32 count and that many records.
+ * Version 1 files hold raw collection events after the cell size.
+ */
+class ANDERSON_TASK_API FCollectionAnalyticsWorker : public FRunnable
+{
+public:
+	static constexpr uint32 Magic = 0x45434B53; // "SKCE"
+	static constexpr uint16 Version = 2;
+
+	explicit FCollectionAnalyticsWorker(const FCollectionAnalyticsSettings& InSettings);
+	virtual ~FCollectionAnalyticsWorker() override;
+
+	/**
+	 * @brief Starts the worker thread.
+	 * @return false if the platform cannot run threads.
+	 */
+	bool Start();
+
+	/**
+	 * @brief Stops the thread after a final drain; blocks until it exits.
+	 */
+	void Shutdown();
+
+	/**
+	 * @brief Queues a record. Safe from any thread, never blocks.
+	 * @param Event - The record to queue.
+	 */
+	FORCEINLINE void Enqueue(const FSkaterCollectionEvent& Event) { Collections.Enqueue(Event); }
+	FORCEINLINE void Enqueue(const FSkaterMovementSample& Sample) { Samples.Enqueue(Sample); }
+	FORCEINLINE void Enqueue(const FSkaterArtifactPlacement& Placement) { Placements.Enqueue(Placement); }
+
+	/**
+	 * @brief Copies the aggregates built so far.
+	 * @param OutSnapshot - Receives the aggregates.
+	 */
+	void GetSnapshot(FCollectionAnalyticsSnapshot& OutSnapshot) const;
+
+	// FRunnable interface
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	/**
+	 * @brief Moves every queued record into the aggregates and the log.
+	 */
+	void Drain();
+
+	/**
+	 * @brief Converts a location into its heatmap cell.
+	 */
+	FIntPoint GetCell(const FVector3f& Location) const;
+
+	/**
+	 * @brief Appends one block of records to the current log file.
+	 */
+	template <typename RecordType>
+	void WriteBlock(ESkaterAnalyticsRecord Type, TArray<RecordType>& Records);
+
+	/**
+	 * @brief Closes the current log file and opens the next, deleting the oldest past MaxFiles.
+	 */
+	void RollLogFile();
+
+	/**
+	 * @brief Gets the path of a log file.
+	 */
+	FString GetLogPath(int32 Index) const;
+
+private:
+	FCollectionAnalyticsSettings Settings;
+
+	TQueue<FSkaterCollectionEvent, EQueueMode::Mpsc> Collections;
+
+	TQueue<FSkaterMovementSample, EQueueMode::Mpsc> Samples;
+
+	TQueue<FSkaterArtifactPlacement, EQueueMode::Mpsc> Placements;
+
+	FRunnableThread* Thread = nullptr;
+
+	FEvent* WakeEvent = nullptr;
+
+	std::atomic<bool> bStopping = false;
+
+	// Worker thread only ---------------------------------------------
+	TUniquePtr<FArchive> LogWriter;
+
+	int32 LogIndex = INDEX_NONE;
+
+	// Drained records, reused between drains
+	TArray<FSkaterCollectionEvent> CollectionBatch;
+
+	TArray<FSkaterMovementSample> SampleBatch;
+
+	TArray<FSkaterArtifactPlacement> PlacementBatch;
+
+	// Aggregates, read by GetSnapshot --------------------------------
+	mutable FCriticalSection AggregateLock;
+
+	FCollectionAnalyticsSnapshot Aggregates;
+};
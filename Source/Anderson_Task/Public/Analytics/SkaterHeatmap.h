@@ -0,0 +1,165 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSkaterHeatmap, Log, All);
+
+/**
+ * Heatmap layers built from the analytics streams.
+ */
+enum class ESkaterHeatmapLayer : uint8
+{
+	// Collections per cell
+	Pickups,
+
+	// Artifact spawns per cell
+	Placements,
+
+	// Pickups divided by placements
+	PickupRate,
+
+	// Seconds skaters spent in the cell
+	DwellTime,
+
+	// Number of times a skater entered the cell
+	Visits,
+
+	Num
+};
+
+/**
+ * @brief Analytics records loaded from binary logs, one array per field.
+ * @details Field arrays keep the accumulation loops over contiguous floats.
+ */
+struct ANDERSON_TASK_API FSkaterAnalyticsStreams
+{
+	TArray<float> CollectionX;
+	TArray<float> CollectionY;
+	TArray<float> CollectionZ;
+	TArray<uint32> CollectionDataIds;
+	TArray<int32> CollectionPoints;
+
+	// Movement samples in recorded order
+	TArray<float> SampleX;
+	TArray<float> SampleY;
+	TArray<uint32> SampleSkaterIds;
+
+	TArray<float> PlacementX;
+	TArray<float> PlacementY;
+	TArray<float> PlacementZ;
+	TArray<uint32> PlacementDataIds;
+
+	// Cell size and sample interval of the first loaded log, 0 until one is loaded
+	float LogCellSize = 0.f;
+
+	float SampleInterval = 0.f;
+
+	/**
+	 * @brief Appends the records of one log file written by FCollectionAnalyticsWorker.
+	 * @details A file truncated by a crash loads up to its last complete block.
+	 *
+	 * @param Path - The log file.
+	 * @return false if the file could not be read or is not an analytics log.
+	 */
+	bool LoadLogFile(const FString& Path);
+
+	FORCEINLINE int32 NumCollections() const { return CollectionX.Num(); }
+	FORCEINLINE int32 NumSamples() const { return SampleX.Num(); }
+	FORCEINLINE int32 NumPlacements() const { return PlacementX.Num(); }
+};
+
+/**
+ * @brief 2D grid of pickup, placement and movement statistics over the XY plane of one map.
+ * @details Every layer is a dense float array over Width x Height cells covering the bounds of the
+ * recorded data. Accumulation first computes the cell index of every record in a branch-free loop
+ * over the position arrays, then scatters the weights into the layer.
+ */
+class ANDERSON_TASK_API FSkaterHeatmap
+{
+public:
+	// Largest grid edge in cells; the cell size grows to fit larger maps
+	static constexpr int32 MaxGridSize = 4096;
+
+	/**
+	 * @brief Bins the streams into a new grid.
+	 *
+	 * @param Streams - The records to bin.
+	 * @param InCellSize - Edge length of one cell in world units.
+	 */
+	void Build(const FSkaterAnalyticsStreams& Streams, float InCellSize);
+
+	/**
+	 * @brief Gets the value of a layer at a cell.
+	 *
+	 * @param Layer - The layer to read.
+	 * @param CellIndex - Row-major cell index.
+	 * @return The value, 0 for an empty cell.
+	 */
+	float GetValue(ESkaterHeatmapLayer Layer, int32 CellIndex) const;
+
+	/**
+	 * @brief Writes every non-empty cell with all layers as CSV.
+	 * @param Path - Output file.
+	 * @return true if the file was written.
+	 */
+	bool ExportCsv(const FString& Path) const;
+
+	/**
+	 * @brief Writes one layer as a PNG, one pixel per cell with X along rows.
+	 * @details Values are normalised to the layer maximum and mapped from blue to red; empty
+	 * cells are black.
+	 *
+	 * @param Path - Output file.
+	 * @param Layer - The layer to write.
+	 * @return true if the file was written.
+	 */
+	bool ExportPng(const FString& Path, ESkaterHeatmapLayer Layer) const;
+
+	/**
+	 * @brief Writes the placements that were never collected as CSV, one row per location.
+	 *
+	 * @param Streams - The records to search.
+	 * @param Path - Output file.
+	 * @param OutNumUnreached - Receives the number of rows written.
+	 * @return true if the file was written.
+	 */
+	static bool ExportUnreached(const FSkaterAnalyticsStreams& Streams, const FString& Path, int32& OutNumUnreached);
+
+	/**
+	 * @brief Gets the display name of a layer, used in file names and CSV headers.
+	 */
+	static const TCHAR* GetLayerName(ESkaterHeatmapLayer Layer);
+
+	FORCEINLINE int32 GetWidth() const { return Width; }
+	FORCEINLINE int32 GetHeight() const { return Height; }
+	FORCEINLINE float GetCellSize() const { return CellSize; }
+
+private:
+	/**
+	 * @brief Computes the row-major cell index of every position.
+	 */
+	void ComputeCellIndices(const TArray<float>& X, const TArray<float>& Y, TArray<int32>& OutCells) const;
+
+	/**
+	 * @brief Adds Weight to Layer at every cell index.
+	 */
+	static void Accumulate(const TArray<int32>& Cells, float Weight, TArray<float>& Layer);
+
+private:
+	// World XY of the grid's minimum corner
+	FVector2f Origin = FVector2f::ZeroVector;
+
+	float CellSize = 1.f;
+
+	int32 Width = 0;
+
+	int32 Height = 0;
+
+	TArray<float> Pickups;
+
+	TArray<float> Placements;
+
+	TArray<float> DwellSeconds;
+
+	TArray<float> Visits;
+};
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Characters/SkaterCharacterBase.h"
+#include "SkaterAICharacter.generated.h"
+
+class USplineComponent;
+
+/**
+ * @brief Bot skater possessed by ASkaterAIController.
+ * @details Spawned or placed bots are possessed automatically and get a player state, so they
+ * score and rank like players. Camera components stay inert and steering is batched by default
+ * to keep large crowds cheap.
+ */
+UCLASS(Config = Game)
+class ANDERSON_TASK_API ASkaterAICharacter : public ASkaterCharacterBase
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Constructor for ASkaterAICharacter.
+	 * @details Sets the AI controller class and disables camera work.
+	 * 
+	 * @param ObjectInitializer - Initializer forwarded to the skater base.
+	 */
+	ASkaterAICharacter(const FObjectInitializer& ObjectInitializer);
+
+	/**
+	 * @brief Gets the route this bot follows while idle.
+	 * @return The route's spline, or nullptr.
+	 */
+	USplineComponent* GetRouteSpline() const;
+
+protected:
+	// Actor with a spline component to follow while no artifact is in reach
+	UPROPERTY(EditInstanceOnly, BlueprintReadWrite, Category = "AI")
+	TObjectPtr<AActor> RouteActor;
+};
@@ -6,6 +6,8 @@
 
 class USpringArmComponent;
 class UCameraComponent;
+class USkaterMovementComponent;
+class USkaterInputRecorderComponent;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogSkaterCharacter, Log, All);
 
@@ -34,9 +36,12 @@ class ASkaterCharacterBase : public ACharacter
 public:
 	/**
 	 * @brief Constructor for ASkaterCharacterBase. 
-	 * @details Sets default values for this character's properties, including camera setup.
+	 * @details Sets default values for this character's properties, including camera setup, and
+	 * replaces the default movement component with USkaterMovementComponent.
+	 * 
+	 * @param ObjectInitializer - Initializer used to override the movement component class.
 	 */
-	ASkaterCharacterBase();
+	ASkaterCharacterBase(const FObjectInitializer& ObjectInitializer);
 
 	/** 
 	 * @brief Called every frame.
@@ -48,10 +53,40 @@ public:
 
 	/**
 	 * @brief Called after the components have been initialized.
-	 * @details Caches the CharacterMovementComponent for efficient access during gameplay.
+	 * @details Caches the SkaterMovementComponent for efficient access during gameplay and pushes
+	 * the steering and deceleration tuning into it.
 	 */
 	virtual void PostInitializeComponents() override;
 
+	/**
+	 * @brief Called when the game starts.
+	 * @details Registers the skater as an artifact collector and for significance scoring.
+	 */
+	virtual void BeginPlay() override;
+
+	/**
+	 * @brief Called when the skater is removed from the world.
+	 * @details Unregisters the skater from artifact collection and significance scoring.
+	 * 
+	 * @param EndPlayReason - Why the skater is being removed.
+	 */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/**
+	 * @brief Called when the controller possessing the skater changes.
+	 * @details Drops the skater's cached point system resolution.
+	 */
+	virtual void NotifyControllerChanged() override;
+
+	/**
+	 * @brief Called when the skater's PlayerState changes.
+	 * @details Drops the skater's cached point system resolution.
+	 * 
+	 * @param NewPlayerState - The new PlayerState.
+	 * @param OldPlayerState - The previous PlayerState.
+	 */
+	virtual void OnPlayerStateChanged(APlayerState* NewPlayerState, APlayerState* OldPlayerState) override;
+
 	/** 
 	 * @brief Gets the camera boom component.
 	 * @return The camera boom component.
@@ -66,6 +101,20 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Skater|Components")
 	FORCEINLINE UCameraComponent* GetFollowCamera() const { return FollowCamera; }
 
+	/** 
+	 * @brief Gets the skateboard mesh component.
+	 * @return The skateboard mesh component.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Skater|Components")
+	FORCEINLINE UStaticMeshComponent* GetSkateboardMesh() const { return SkateboardMesh; }
+
+	/** 
+	 * @brief Gets the input recorder component.
+	 * @return The input recorder component.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Skater|Components")
+	FORCEINLINE USkaterInputRecorderComponent* GetInputRecorder() const { return InputRecorder; }
+
 	/** 
 	 * @brief Gets the current movement state.
 	 * @return The current movement state.
@@ -87,6 +136,32 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Skater|State")
 	float GetCurrentSpeed() const;
 
+	/**
+	 * @brief Sets the movement input vector directly.
+	 * @details Use this for AI control or external input sources.
+	 * 
+	 * @param NewInput - X for steering, Y for acceleration/braking
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Skater|Input")
+	void SetMovementInput(FVector2D NewInput);
+
+	/**
+	 * @brief Turns the view by a look input value.
+	 * @details Used by live look input and input replay alike.
+	 * 
+	 * @param LookInput - X for yaw, Y for pitch.
+	 */
+	virtual void ApplyLookInput(const FVector2D& LookInput);
+
+	/**
+	 * @brief Enables or disables batched movement for this skater.
+	 * @details Batching only takes effect while the skater is locally controlled.
+	 * 
+	 * @param bUseBatch - Whether to update steering in USkaterMovementBatchSubsystem.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Skater|Movement")
+	void SetUseBatchedMovement(bool bUseBatch);
+
 protected:
 	/** 
 	 * Current movement input vector.
@@ -97,15 +172,6 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "Input")
 	FVector2D CurrentInputVector = FVector2D::ZeroVector;
 
-	/**
-	 * @brief Sets the movement input vector directly.
-	 * @details Use this for AI control or external input sources.
-	 * 
-	 * @param NewInput - X for steering, Y for acceleration/braking
-	 */
-	UFUNCTION(BlueprintCallable, Category = "Skater|Input")
-	void SetMovementInput(FVector2D NewInput);
-
 	/**
 	 * @brief Clears all movement input.
 	 */
@@ -137,36 +203,41 @@ protected:
 	virtual void PostMovementUpdate(float DeltaTime) {}
 
 private:
-	/** 
-	 * @brief Applies skater-specific movement logic.
-	 * @details Handles steering interpolation, rotation, acceleration, and braking.
-	 * Updates animation state flags and adjusts braking deceleration based on input.
-	 * 
-	 * @param DeltaTime - Time elapsed since the last tick.
+	/**
+	 * @brief Drops the skater's entry in the point system cache.
 	 */
-	void UpdateSkaterMovement(float DeltaTime);
+	void InvalidatePointSystemCache() const;
+
+	/**
+	 * @brief Joins or leaves the movement batch to match bUseBatchedMovement and local control.
+	 */
+	void UpdateMovementBatching();
 
 	/**
-	 * @brief Processes steering input.
-	 * @details Interpolates the current turn value based on input and applies rotation to the 
-	 * character.
+	 * @brief Leaves the movement batch, if batched.
+	 */
+	void LeaveMovementBatch();
+
+	/** 
+	 * @brief Feeds skater input into the movement component.
+	 * @details Steering, braking and deceleration are simulated by the movement component's skate
+	 * mode; the character only forwards intent and mirrors the resolved state for animation.
 	 * 
 	 * @param DeltaTime - Time elapsed since the last tick.
 	 */
-	void ProcessSteering(float DeltaTime);
+	void UpdateSkaterMovement(float DeltaTime);
 
 	/**
-	 * @brief Processes acceleration and braking input.
-	 * @details Adjusts movement input, braking deceleration, and animation state flags based 
-	 * on input.
+	 * @brief Processes acceleration input.
+	 * @details Adds forward movement input while accelerating.
 	 */
 	void ProcessAcceleration();
 	
 	/** 
-	 * @brief Gets the cached CharacterMovementComponent.
-	 * @return The cached CharacterMovementComponent, or nullptr if not valid.
+	 * @brief Gets the cached SkaterMovementComponent.
+	 * @return The cached SkaterMovementComponent, or nullptr if not valid.
 	 */
-	FORCEINLINE UCharacterMovementComponent* GetCachedMovementComponent() const
+	FORCEINLINE USkaterMovementComponent* GetCachedMovementComponent() const
 	{
 		return CachedMovementComponent.IsValid() ? CachedMovementComponent.Get() : nullptr;
 	}
@@ -190,6 +261,10 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components|Mesh")
 	TObjectPtr<UStaticMeshComponent> SkateboardMesh;
 
+	// Records and replays the skater's input
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components|Input")
+	TObjectPtr<USkaterInputRecorderComponent> InputRecorder;
+
 	// Movement properties -------------------------------------------
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement|Speed", 
 		meta = (ClampMin = "0.0"))
@@ -220,21 +295,20 @@ protected:
 		meta = (ClampMin = "0.0"))
 	float SteeringInterpSpeed = 5.0f;
 
+	// Update steering in the shared movement batch instead of this actor's tick. The actor stops
+	// ticking, so Pre/PostMovementUpdate are not called; meant for AI and replay crowds.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement|Batching")
+	bool bUseBatchedMovement = false;
+
 	// Camera properties ---------------------------------------------
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Camera", 
 		meta = (ClampMin = "0.0"))
 	float CameraArmLength = 300.f;
 
 private:
-	// Cached CharacterMovementComponent
-	TWeakObjectPtr<UCharacterMovementComponent> CachedMovementComponent;
-
-	// Minimum turn value to apply rotation (prevents micro-jitter)
-	static constexpr float TurnDeadzone = 0.01f;
-
-	// Minimum forward input to register as acceleration/braking
-	static constexpr float InputDeadzone = 0.1f;
+	// Cached SkaterMovementComponent
+	TWeakObjectPtr<USkaterMovementComponent> CachedMovementComponent;
 
-	// Current turn value for steering interpolation
-	float CurrentTurnValue = 0.f;
+	// Handle in the movement batch, INDEX_NONE when ticking per actor
+	int32 MovementBatchHandle = INDEX_NONE;
 };
\ No newline at end of file
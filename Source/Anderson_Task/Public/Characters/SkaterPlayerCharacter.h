@@ -23,13 +23,22 @@ public:
 	 * @brief Constructor for ASkaterPlayerCharacter.
 	 * @details Sets default values for this character's properties, including camera setup and input actions
 	 * using Enhanced Input.
+	 * 
+	 * @param ObjectInitializer - Initializer forwarded to the skater base.
+	 */
+	ASkaterPlayerCharacter(const FObjectInitializer& ObjectInitializer);
+
+	/**
+	 * @brief Turns the view by a look input value scaled by LookSensitivity.
+	 * @param LookInput - X for yaw, Y for pitch.
 	 */
-	ASkaterPlayerCharacter();
+	virtual void ApplyLookInput(const FVector2D& LookInput) override;
 
 protected:
 	/** 
 	 * @brief Notifies when the controller has changed.
-	 * @details Sets up the input mapping context for the new controller.
+	 * @details Sets up the input mapping context for the new controller and starts command-line
+	 * input recording or replay.
 	 */
 	virtual void NotifyControllerChanged() override;
 	
@@ -63,6 +72,21 @@ private:
 	 */
 	void HandleLookInput(const FInputActionValue& Value);
 
+	/** 
+	 * @brief Handles jump press.
+	 */
+	void HandleJumpInput();
+
+	/** 
+	 * @brief Handles jump release.
+	 */
+	void HandleJumpInputReleased();
+
+	/**
+	 * @brief Checks if live input should be ignored because a recording is replaying.
+	 */
+	bool IsReplayingInput() const;
+
 protected:
 
 	// Input Actions & Mapping Contexts ------------------------------
@@ -4,9 +4,10 @@
 #include "GameFramework/Actor.h"
 #include "Interfaces/Artifact.h"
 #include "Interfaces/Collectable.h"
+#include "Collectables/Rendering/ArtifactInstanceManager.h"
 #include "PointArtifact.generated.h"
 
-class USphereComponent;
+class USceneComponent;
 class UStaticMeshComponent;
 class UArtifactData;
 class UCollectionFeedbackComponent;
@@ -24,9 +25,71 @@ class ANDERSON_TASK_API APointArtifact : public AActor, public ICollectable, pub
 public:
 	APointArtifact();
 
+	/**
+	 * @brief Reactivates the artifact in place with new data.
+	 * @details Used by the artifact pool to recycle artifacts instead of spawning new ones.
+	 * Restores visuals, shows the actor and registers it for collection again.
+	 * 
+	 * @param NewData - The artifact data to assign.
+	 * @param NewTransform - The world transform to move the artifact to.
+	 */
+	void ResetArtifact(UArtifactData* NewData, const FTransform& NewTransform);
+
+	/**
+	 * @brief Deactivates and hides the artifact without destroying it.
+	 * @details The artifact stops being collectable until ResetArtifact is called.
+	 */
+	void DeactivateArtifact();
+
+	/**
+	 * @brief Gets the data asset describing this artifact.
+	 * @return The artifact data, or nullptr if unset.
+	 */
+	FORCEINLINE UArtifactData* GetArtifactData() const { return ArtifactData; }
+
+	/**
+	 * @brief Finds the IPointSystem interface in the given actor.
+	 * @details Searches the actor for an implementation of the IPointSystem interface.
+	 * 
+	 * @param Actor - The actor to search for a point system.
+	 * @return The IPointSystem interface if found, nullptr otherwise.
+	 */
+	static IPointSystem* FindPointSystemInActor(AActor* Actor);
+
+	/**
+	 * @brief Checks if the artifact replicates through the collection manager.
+	 * @details Only level-placed artifacts have a name stable across machines.
+	 * @return true if the artifact opted in and was loaded with its level.
+	 */
+	FORCEINLINE bool UsesCollectionManager() const { return bUseCollectionManager && IsNetStartupActor(); }
+
+	/**
+	 * @brief Applies collected state received through the collection manager.
+	 * @details Client only; the artifact itself does not replicate in this mode.
+	 * 
+	 * @param bCollected - true if the artifact was collected on the server.
+	 * @param bPlayFeedback - Whether to play collection feedback; off for the initial state.
+	 */
+	void ApplyReplicatedCollection(bool bCollected, bool bPlayFeedback);
+
 protected:
 	virtual void PostInitializeComponents() override;
 
+	// Replication setup
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	/**
+	 * @brief Called when the game starts.
+	 * @details Registers the artifact with the artifact registry, which handles collection detection.
+	 */
+	virtual void BeginPlay() override;
+
+	/**
+	 * @brief Called when the artifact is removed from the world.
+	 * @details Unregisters the artifact from the artifact registry.
+	 */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	// ICollectable interface
 	/**
 	 * @brief Handles the collection of the artifact.
@@ -68,33 +131,83 @@ protected:
 
 private:
 	/**
-	 * @brief Handler for when another actor begins overlapping the artifact's collision sphere.
-	 * @details Initiates the collection process if the overlapping actor can collect the artifact.
+	 * @brief Applies the mesh and material from the artifact data to the mesh component.
+	 */
+	void ApplyArtifactVisuals();
+
+	/**
+	 * @brief Sets the replicated active state.
+	 * @details Wakes the artifact from dormancy and marks the property dirty for push-model
+	 * replication. The artifact returns to dormancy once the change has been sent.
 	 * 
-	 * @param OverlappedComponent The component that was overlapped.
-	 * @param OtherActor The actor that initiated the overlap.
-	 * @param OtherComp The specific component of the other actor that was involved in the overlap.
-	 * @param OtherBodyIndex The body index of the other component.
-	 * @param bFromSweep Whether the overlap was the result of a sweep.
-	 * @param SweepResult Details about the hit result if bFromSweep is true.
+	 * @param bNewActive - The new active state.
+	 */
+	void SetIsActive(bool bNewActive);
+
+	/**
+	 * @brief Shows the artifact and makes it collectable on this machine.
+	 */
+	void ActivateLocally();
+
+	/**
+	 * @brief Hides the artifact and stops it being collectable on this machine.
+	 */
+	void DeactivateLocally();
+
+	/**
+	 * @brief Fades a persistent artifact to its collected opacity.
+	 */
+	void ApplyCollectedVisuals();
+
+	/**
+	 * @brief Applies new artifact data received from the server.
 	 */
 	UFUNCTION()
-	void OnSphereBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
-	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+	void OnRep_ArtifactData();
 
 	/**
-	 * @brief Finds the IPointSystem interface in the given actor.
-	 * @details Searches the actor for an implementation of the IPointSystem interface.
-	 * 
-	 * @param Actor - The actor to search for a point system.
-	 * @return The IPointSystem interface if found, nullptr otherwise.
+	 * @brief Applies a collection or respawn received from the server.
 	 */
-	static IPointSystem* FindPointSystemInActor(AActor* Actor);
+	UFUNCTION()
+	void OnRep_IsActive();
+
+	/**
+	 * @brief Shows or hides the artifact after its active state was replicated.
+	 * @param bPlayFeedback - Whether to play collection feedback when it became inactive.
+	 */
+	void HandleActiveStateReplicated(bool bPlayFeedback);
+
+	/**
+	 * @brief Called when the visual bundle of the artifact data finished streaming.
+	 * @param LoadedData - The artifact data the load was requested for.
+	 */
+	void OnVisualsLoaded(TWeakObjectPtr<UArtifactData> LoadedData);
+
+	/**
+	 * @brief Registers the artifact with the artifact registry, if not registered yet.
+	 */
+	void RegisterWithRegistry();
+
+	/**
+	 * @brief Removes the artifact from the artifact registry, if registered.
+	 */
+	void UnregisterFromRegistry();
+
+	/**
+	 * @brief Moves the artifact's visuals into the shared instance manager.
+	 * @details Used when bUseInstancedRendering is set; clears the per-actor mesh on success.
+	 */
+	void AcquireRenderInstance();
+
+	/**
+	 * @brief Returns the artifact's instance to the instance manager, if it owns one.
+	 */
+	void ReleaseRenderInstance();
 
 protected:
 	// Components
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
-	TObjectPtr<USphereComponent> CollisionSphere;
+	TObjectPtr<USceneComponent> SceneRoot;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
 	TObjectPtr<UStaticMeshComponent> MeshComponent;
@@ -102,9 +215,32 @@ protected:
 	UPROPERTY(VisibleAnywhere, Category = "Components")
 	TObjectPtr<UCollectionFeedbackComponent> FeedbackComponent;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Artifact")
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, ReplicatedUsing = OnRep_ArtifactData, Category = "Artifact")
 	TObjectPtr<UArtifactData> ArtifactData;
 
-	UPROPERTY(BlueprintReadOnly, Category = "State")
+	// Radius around the actor location in which a skater capsule collects the artifact
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Artifact", meta = (ClampMin = "0.0"))
+	float CollectionRadius = 50.f;
+
+	// Render through the shared instance manager instead of a per-actor mesh component
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Artifact|Rendering")
+	bool bUseInstancedRendering = false;
+
+	// Replicate the collected state through the level-wide collection manager instead of an actor channel
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Artifact|Replication")
+	bool bUseCollectionManager = false;
+
+	// Collected state, the only per-artifact state replicated after spawn
+	UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_IsActive, Category = "State")
 	bool bIsActive = true;
+
+private:
+	// Handle into the artifact registry, INDEX_NONE when not registered
+	int32 RegistryHandle = INDEX_NONE;
+
+	// Instance owned in the instance manager when bUseInstancedRendering is set
+	FArtifactInstanceHandle InstanceHandle;
+
+	// Index in the collection manager on the server, INDEX_NONE when unmanaged
+	int32 CollectionIndex = INDEX_NONE;
 };
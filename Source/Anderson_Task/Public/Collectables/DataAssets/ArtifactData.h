@@ -25,13 +25,43 @@ public:
 	 */
 	virtual FPrimaryAssetId GetPrimaryAssetId() const override;
 
+	/**
+	 * @brief Checks if the assets of the "Visual" bundle are resident.
+	 * @return true if Mesh and Material are loaded or unset.
+	 */
+	bool AreVisualsLoaded() const;
+
+	/**
+	 * @brief Checks if the assets of the "Feedback" bundle are resident.
+	 * @return true if CollectionSound and CollectionEffect are loaded or unset.
+	 */
+	bool AreFeedbackAssetsLoaded() const;
+
+	/**
+	 * @brief Gets the assets of a bundle that are set but not resident yet.
+	 * @details Lets callers stream a bundle directly when the AssetManager does not track this asset.
+	 *
+	 * @param Bundle - VisualBundle or FeedbackBundle.
+	 * @param OutPaths - Receives the paths still to load.
+	 */
+	void GetUnloadedBundleAssets(FName Bundle, TArray<FSoftObjectPath>& OutPaths) const;
+
 public:
+	// Primary asset type shared by all artifact data assets
+	static const FPrimaryAssetType ArtifactAssetType;
+
+	// Asset bundle holding the mesh and material
+	static const FName VisualBundle;
+
+	// Asset bundle holding the collection sound and effect
+	static const FName FeedbackBundle;
+
 	// Visual and audio properties
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Visual")
-	TObjectPtr<UStaticMesh> Mesh;
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Visual", meta = (AssetBundles = "Visual"))
+	TSoftObjectPtr<UStaticMesh> Mesh;
 
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Visual")
-	TObjectPtr<UMaterialInterface> Material;
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Visual", meta = (AssetBundles = "Visual"))
+	TSoftObjectPtr<UMaterialInterface> Material;
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Visual")
 	bool bIsToPersistAfterCollection = false;
@@ -40,16 +70,24 @@ public:
 		meta = (EditCondition = "bIsToPersistAfterCollection", ClampMin = "0.0", ClampMax = "1.0"))
 	float OpacityAfterCollection = 0.3f;
 
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Audio")
-	TObjectPtr<USoundBase> CollectionSound;
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Audio", meta = (AssetBundles = "Feedback"))
+	TSoftObjectPtr<USoundBase> CollectionSound;
 
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "VFX")
-	TObjectPtr<UFXSystemAsset> CollectionEffect;
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "VFX", meta = (AssetBundles = "Feedback"))
+	TSoftObjectPtr<UFXSystemAsset> CollectionEffect;
 	
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "VFX", 
 		meta = (ClampMin = "0.0"))
 	float EffectDuration;
 
+	// Higher priority feedback may steal pooled slots from lower priority feedback
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Feedback")
+	int32 FeedbackPriority = 0;
+
+	// Audio and effect components created ahead of time for this artifact type
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Feedback", meta = (ClampMin = "0"))
+	int32 FeedbackPrewarmCount = 2;
+
 	// Artifact properties
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Artifact")
 	FText ArtifactName;
@@ -59,4 +97,8 @@ public:
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Artifact")
 	int32 PointValue = 100;
+
+	// Seconds before a collected artifact becomes collectable again in place (0 = never respawn)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Artifact", meta = (ClampMin = "0.0"))
+	float RespawnDelay = 0.f;
 };
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "ArtifactPlacementData.generated.h"
+
+class APointArtifact;
+class UArtifactData;
+
+/**
+ * @brief One artifact placement: world location, quantised yaw and artifact type (16 bytes).
+ */
+USTRUCT()
+struct FArtifactPlacement
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "Placement")
+	FVector3f Location = FVector3f::ZeroVector;
+
+	// Yaw in 1/65536 of a turn
+	UPROPERTY(EditAnywhere, Category = "Placement")
+	uint16 PackedYaw = 0;
+
+	// Index into the owning asset's ArtifactTypes
+	UPROPERTY(EditAnywhere, Category = "Placement")
+	uint16 TypeIndex = 0;
+
+	/**
+	 * @brief Gets the yaw in degrees.
+	 * @return The yaw in [0, 360).
+	 */
+	FORCEINLINE float GetYaw() const { return PackedYaw * (360.f / 65536.f); }
+
+	/**
+	 * @brief Quantises and stores a yaw.
+	 * @param Yaw - The yaw in degrees, any range.
+	 */
+	FORCEINLINE void SetYaw(float Yaw)
+	{
+		PackedYaw = static_cast<uint16>(FMath::RoundToInt(FRotator::ClampAxis(Yaw) * (65536.f / 360.f)) & 0xFFFF);
+	}
+
+	friend FArchive& operator<<(FArchive& Ar, FArtifactPlacement& Placement)
+	{
+		Ar << Placement.Location << Placement.PackedYaw << Placement.TypeIndex;
+		return Ar;
+	}
+};
+
+static_assert(sizeof(FArtifactPlacement) == 16, "FArtifactPlacement is bulk serialized and must stay packed");
+
+/**
+ * @brief Compact list of artifact placements for one streaming cell.
+ * @details Replaces level-placed artifact actors on large maps. An AArtifactPlacementCell
+ * references one of these assets and materialises its placements through the artifact pool
+ * while the cell is loaded. Artifact types are stored once per asset and referenced by index.
+ * Placements are saved as one raw block rather than with tagged per-property serialization.
+ */
+UCLASS(BlueprintType)
+class ANDERSON_TASK_API UArtifactPlacementData : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	// UObject interface
+	virtual void Serialize(FArchive& Ar) override;
+
+	/**
+	 * @brief Gets the world transform of a placement.
+	 * @param Index - The placement index.
+	 * @return The transform, unscaled.
+	 */
+	FTransform GetPlacementTransform(int32 Index) const;
+
+	/**
+	 * @brief Gets the artifact data of a placement.
+	 * @param Index - The placement index.
+	 * @return The data, or nullptr if the type index is out of range.
+	 */
+	UArtifactData* GetPlacementData(int32 Index) const;
+
+	/**
+	 * @brief Gets the number of placements.
+	 * @return Number of placements in the asset.
+	 */
+	FORCEINLINE int32 GetNumPlacements() const { return Placements.Num(); }
+
+public:
+	// Artifact class spawned for every placement
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Placement")
+	TSubclassOf<APointArtifact> ArtifactClass;
+
+	// Artifact types referenced by the placements
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Placement")
+	TArray<TObjectPtr<UArtifactData>> ArtifactTypes;
+
+	// Bulk serialized in Serialize
+	UPROPERTY(EditAnywhere, SkipSerialization, Category = "Placement")
+	TArray<FArtifactPlacement> Placements;
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "ArtifactPlacementCell.generated.h"
+
+class APointArtifact;
+class UArtifactPlacementData;
+
+/**
+ * @brief Lightweight actor that materialises the artifacts of one streaming cell.
+ * @details Placed in a World Partition map (and optionally a data layer), it streams in and out
+ * with its cell like any spatially loaded actor. On the server its BeginPlay acquires pooled
+ * artifacts for every placement not yet collected, PlacementsPerFrame at a time, and its EndPlay
+ * returns them to the pool, so live artifacts are bounded by the streamed area. Collected
+ * placements are remembered by UArtifactPlacementSubsystem across unload and reload. The cell
+ * itself does not replicate; clients receive the pooled artifacts.
+ */
+UCLASS()
+class ANDERSON_TASK_API AArtifactPlacementCell : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AArtifactPlacementCell();
+
+	virtual void Tick(float DeltaTime) override;
+
+	/**
+	 * @brief Drops the cell's reference to an artifact that went back to the pool on collection.
+	 * @param PlacementIndex - The collected placement.
+	 */
+	void ForgetArtifact(int32 PlacementIndex);
+
+	/**
+	 * @brief Gets the placement data materialised by this cell.
+	 * @return The placement data, or nullptr if unset.
+	 */
+	FORCEINLINE UArtifactPlacementData* GetPlacementData() const { return PlacementData; }
+
+	/**
+	 * @brief Checks if every placement has been processed.
+	 * @return true once all uncollected placements are materialised.
+	 */
+	bool IsFullyMaterialized() const;
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	/**
+	 * @brief Acquires artifacts for the next batch of placements.
+	 */
+	void MaterializeNext();
+
+	/**
+	 * @brief Returns every artifact still owned by the cell to the pool.
+	 */
+	void ReleaseArtifacts();
+
+public:
+	// Placements materialised by this cell
+	UPROPERTY(EditAnywhere, Category = "Placement")
+	TObjectPtr<UArtifactPlacementData> PlacementData;
+
+	// Artifacts acquired per frame while the cell streams in
+	UPROPERTY(EditAnywhere, Category = "Placement", meta = (ClampMin = "1"))
+	int32 PlacementsPerFrame = 64;
+
+private:
+	// Artifact per placement index, null if collected or not materialised yet
+	TArray<TWeakObjectPtr<APointArtifact>> Artifacts;
+
+	// Next placement to materialise
+	int32 NextPlacement = 0;
+
+	bool bMaterializing = false;
+};
@@ -0,0 +1,216 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "GameFramework/Actor.h"
+#include "ArtifactPlacementGenerator.generated.h"
+
+class AArtifactPlacementCell;
+class APointArtifact;
+class UArtifactData;
+class UArtifactPlacementData;
+class UBoxComponent;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogArtifactPlacement, Log, All);
+
+/**
+ * @brief Where a placement generator distributes artifacts.
+ */
+UENUM()
+enum class EArtifactDistributionMode : uint8
+{
+	// Along the splines of SourceSplines
+	Spline,
+
+	// On the geometry below the bounds, traced from the top of the box
+	Surface,
+
+	// Anywhere inside the bounds
+	Volume
+};
+
+/**
+ * @brief Artifact type picked by the generator with a relative weight.
+ */
+USTRUCT()
+struct FArtifactTypeWeight
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "Placement")
+	TObjectPtr<UArtifactData> Data;
+
+	UPROPERTY(EditAnywhere, Category = "Placement", meta = (ClampMin = "0.0"))
+	float Weight = 1.f;
+};
+
+/**
+ * @brief Editor-only actor generating artifact placements procedurally.
+ * @details Samples positions with Poisson-disk sampling (Bridson) inside its bounds, or walks the
+ * source splines at MinSpacing with jitter, keeping every pair of placements at least MinSpacing
+ * apart. Artifact types are picked by weight. The result is split into a grid of OutputCellSize and
+ * saved as one UArtifactPlacementData asset per cell, never as individual actors. Generating also
+ * spawns an AArtifactPlacementCell for every new asset, from the editor or headless through the
+ * ArtifactPlacement commandlet.
+ *
+ * Generation is deterministic for a given Seed and level geometry.
+ */
+UCLASS(HideCategories = (Collision, Physics, Rendering, Input, HLOD, Replication))
+class ANDERSON_TASK_API AArtifactPlacementGenerator : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AArtifactPlacementGenerator();
+
+#if WITH_EDITOR
+	/**
+	 * @brief Regenerates the placements and saves the placement assets.
+	 */
+	UFUNCTION(CallInEditor, Category = "Placement")
+	void Generate();
+
+	/**
+	 * @brief Regenerates the placements and saves the placement assets.
+	 * @details Assets generated previously whose cell is now empty are saved empty, so cells
+	 * referencing them stay valid.
+	 *
+	 * @param bSpawnCells - Whether to spawn an AArtifactPlacementCell for assets without one.
+	 * @param OutSpawnedCells - Optionally receives the spawned cells, which the caller must save.
+	 * @return Number of placements generated, or INDEX_NONE if an asset failed to save or a cell
+	 * failed to spawn.
+	 */
+	int32 GenerateAndSave(bool bSpawnCells, TArray<AArtifactPlacementCell*>* OutSpawnedCells = nullptr);
+#endif
+
+private:
+#if WITH_EDITOR
+	/**
+	 * @brief A generated placement before it is packed into a cell asset.
+	 */
+	struct FGeneratedPlacement
+	{
+		FVector Location;
+
+		float Yaw = 0.f;
+
+		UArtifactData* Data = nullptr;
+	};
+
+	/**
+	 * @brief Samples placement positions for the current mode.
+	 * @param Stream - Random stream seeded from Seed.
+	 * @param OutLocations - Receives the sampled world locations.
+	 */
+	void SampleLocations(FRandomStream& Stream, TArray<FVector>& OutLocations) const;
+
+	/**
+	 * @brief Walks every source spline, sampling locations at least MinSpacing apart.
+	 */
+	void SampleSplines(FRandomStream& Stream, TArray<FVector>& OutLocations) const;
+
+	/**
+	 * @brief Traces down onto the level geometry.
+	 *
+	 * @param Location - Location to trace below; receives the hit location.
+	 * @param TraceStart - Height to trace from.
+	 * @param TraceEnd - Height to trace to.
+	 * @return true if walkable geometry was hit.
+	 */
+	bool ProjectToSurface(FVector& Location, double TraceStart, double TraceEnd) const;
+
+	/**
+	 * @brief Picks an artifact type by weight.
+	 * @return The picked type, or nullptr if no type has a positive weight.
+	 */
+	UArtifactData* PickArtifactType(FRandomStream& Stream) const;
+
+	/**
+	 * @brief Packs placements into one asset per output cell and saves them.
+	 * @return false if an asset failed to save.
+	 */
+	bool SavePlacementAssets(const TArray<FGeneratedPlacement>& Placements);
+
+	/**
+	 * @brief Spawns a placement cell for every non-empty generated asset not yet referenced by one.
+	 * @details Cells of partitioned maps are external actors, so unloaded cells are checked too.
+	 *
+	 * @param OutSpawnedCells - Receives the spawned cells.
+	 * @return false if a cell failed to spawn.
+	 */
+	bool SpawnMissingCells(TArray<AArtifactPlacementCell*>& OutSpawnedCells);
+#endif
+
+public:
+	// Region sampled in Surface and Volume modes
+	UPROPERTY(VisibleAnywhere, Category = "Placement")
+	TObjectPtr<UBoxComponent> Bounds;
+
+	UPROPERTY(EditAnywhere, Category = "Placement")
+	EArtifactDistributionMode Mode = EArtifactDistributionMode::Surface;
+
+	// Actors whose spline components are walked in Spline mode
+	UPROPERTY(EditAnywhere, Category = "Placement", meta = (EditCondition = "Mode == EArtifactDistributionMode::Spline"))
+	TArray<TObjectPtr<AActor>> SourceSplines;
+
+	// Width of the band around each spline that placements are scattered across
+	UPROPERTY(EditAnywhere, Category = "Placement", meta = (EditCondition = "Mode == EArtifactDistributionMode::Spline", ClampMin = "0.0"))
+	float SplineWidth = 0.f;
+
+	// Whether spline placements are dropped onto the geometry below them
+	UPROPERTY(EditAnywhere, Category = "Placement", meta = (EditCondition = "Mode == EArtifactDistributionMode::Spline"))
+	bool bProjectSplineToSurface = false;
+
+	// Minimum distance between two placements
+	UPROPERTY(EditAnywhere, Category = "Placement", meta = (ClampMin = "10.0"))
+	float MinSpacing = 400.f;
+
+	// Fraction of the sampled positions kept; thins the distribution without breaking MinSpacing
+	UPROPERTY(EditAnywhere, Category = "Placement", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float Density = 1.f;
+
+	UPROPERTY(EditAnywhere, Category = "Placement")
+	TArray<FArtifactTypeWeight> ArtifactTypes;
+
+	// Artifact class written to the placement assets; APointArtifact if unset
+	UPROPERTY(EditAnywhere, Category = "Placement")
+	TSubclassOf<APointArtifact> ArtifactClass;
+
+	UPROPERTY(EditAnywhere, Category = "Placement")
+	int32 Seed = 0;
+
+	// Height of the artifact above the sampled position
+	UPROPERTY(EditAnywhere, Category = "Placement")
+	float HeightOffset = 50.f;
+
+	UPROPERTY(EditAnywhere, Category = "Placement")
+	bool bRandomYaw = true;
+
+	// Channel traced against when projecting onto surfaces
+	UPROPERTY(EditAnywhere, Category = "Placement|Surface")
+	TEnumAsByte<ECollisionChannel> TraceChannel = ECC_WorldStatic;
+
+	// Steepest surface in degrees that still receives artifacts
+	UPROPERTY(EditAnywhere, Category = "Placement|Surface", meta = (ClampMin = "0.0", ClampMax = "90.0"))
+	float MaxSurfaceSlope = 45.f;
+
+	// Safety cap on generated placements
+	UPROPERTY(EditAnywhere, Category = "Placement", meta = (ClampMin = "1"))
+	int32 MaxPlacements = 100000;
+
+	// Content folder receiving the placement assets
+	UPROPERTY(EditAnywhere, Category = "Placement|Output")
+	FString OutputPath = TEXT("/Game/Artifacts/Placement");
+
+	// Asset name prefix; the actor name if empty. Assets are <Name>_<CellX>_<CellY>
+	UPROPERTY(EditAnywhere, Category = "Placement|Output")
+	FString OutputName;
+
+	// Edge length of one output cell, ideally the World Partition cell size
+	UPROPERTY(EditAnywhere, Category = "Placement|Output", meta = (ClampMin = "100.0"))
+	float OutputCellSize = 12800.f;
+
+	// Assets written by the last generation
+	UPROPERTY(VisibleAnywhere, Category = "Placement|Output")
+	TArray<TSoftObjectPtr<UArtifactPlacementData>> GeneratedAssets;
+};
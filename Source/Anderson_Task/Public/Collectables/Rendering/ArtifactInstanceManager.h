@@ -0,0 +1,85 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "ArtifactInstanceManager.generated.h"
+
+class UHierarchicalInstancedStaticMeshComponent;
+class UStaticMesh;
+class UMaterialInterface;
+
+/**
+ * @brief Identifies one artifact instance inside the instance manager.
+ */
+struct FArtifactInstanceHandle
+{
+	// Index of the mesh/material batch
+	int32 BatchIndex = INDEX_NONE;
+
+	// Instance index inside the batch component
+	int32 InstanceIndex = INDEX_NONE;
+
+	FORCEINLINE bool IsValid() const { return BatchIndex != INDEX_NONE && InstanceIndex != INDEX_NONE; }
+	FORCEINLINE void Invalidate() { BatchIndex = InstanceIndex = INDEX_NONE; }
+};
+
+/**
+ * @brief Local actor that renders artifacts as hierarchical instanced static meshes.
+ * @details Artifacts sharing the same mesh/material pair are batched into one component.
+ * Instance indices stay stable: released instances are collapsed to zero scale and reused by
+ * later additions. Per-instance custom data float 0 holds the opacity, so materials used in
+ * this mode should read PerInstanceCustomData[0] instead of an "Opacity" scalar parameter.
+ */
+UCLASS(NotBlueprintable, NotPlaceable, Transient)
+class ANDERSON_TASK_API AArtifactInstanceManager : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AArtifactInstanceManager();
+
+	/**
+	 * @brief Adds an instance to the batch matching the mesh/material pair.
+	 *
+	 * @param Mesh - The mesh to render.
+	 * @param Material - Optional material override for slot 0.
+	 * @param Transform - World transform of the instance.
+	 * @return Handle to the new instance, invalid if Mesh is null.
+	 */
+	FArtifactInstanceHandle AddInstance(UStaticMesh* Mesh, UMaterialInterface* Material, const FTransform& Transform);
+
+	/**
+	 * @brief Hides the instance and makes its slot available for reuse.
+	 * @param Handle - The instance to release. Reset to invalid on return.
+	 */
+	void ReleaseInstance(FArtifactInstanceHandle& Handle);
+
+	/**
+	 * @brief Sets the per-instance opacity custom data value.
+	 *
+	 * @param Handle - The instance to update.
+	 * @param Opacity - Opacity value (0-1).
+	 */
+	void SetInstanceOpacity(const FArtifactInstanceHandle& Handle, float Opacity);
+
+private:
+	/**
+	 * @brief Finds or creates the batch for a mesh/material pair.
+	 * @return Index of the batch.
+	 */
+	int32 FindOrAddBatch(UStaticMesh* Mesh, UMaterialInterface* Material);
+
+public:
+	// Index of the opacity value in the per-instance custom data
+	static constexpr int32 OpacityCustomDataIndex = 0;
+
+private:
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UHierarchicalInstancedStaticMeshComponent>> BatchComponents;
+
+	// Released instance slots per batch
+	TArray<TArray<int32>> FreeInstances;
+
+	// Mesh/material pair -> batch index
+	TMap<TPair<const UStaticMesh*, const UMaterialInterface*>, int32> BatchLookup;
+};
@@ -0,0 +1,201 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Info.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "ArtifactCollectionManager.generated.h"
+
+/**
+ * @brief Fixed-size block of the collected bitfield, the unit sent over the network.
+ */
+USTRUCT()
+struct FArtifactCollectionChunk : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	static constexpr int32 NumWords = 8;
+	static constexpr int32 NumBits = NumWords * NumBitsPerDWORD;
+
+	// Position of the chunk in the bitfield; fast array order is not kept on clients
+	UPROPERTY()
+	int32 ChunkIndex = 0;
+
+	UPROPERTY()
+	uint32 Words[8] = {};
+};
+
+static_assert(UE_ARRAY_COUNT(FArtifactCollectionChunk::Words) == FArtifactCollectionChunk::NumWords);
+
+/**
+ * @brief Bitfield of collected artifacts replicated as a fast array of fixed-size chunks.
+ * @details Setting a bit marks only its chunk dirty, so a collection sends one 256-bit chunk instead
+ * of the whole field. Clients copy received chunks into their local bits; their size is rounded up
+ * to whole chunks, the extra bits stay cleared.
+ */
+USTRUCT()
+struct ANDERSON_TASK_API FArtifactCollectionBits : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	/**
+	 * @brief Gets the number of bits.
+	 * @return Number of tracked artifacts.
+	 */
+	FORCEINLINE int32 Num() const { return Bits.Num(); }
+
+	/**
+	 * @brief Checks a bit.
+	 * @param Index - The collection index, must be in range.
+	 * @return true if the artifact is collected.
+	 */
+	FORCEINLINE bool Get(int32 Index) const { return Bits[Index]; }
+
+	/**
+	 * @brief Sets a bit and marks its chunk dirty.
+	 * @details Authority only.
+	 *
+	 * @param Index - The collection index, must be in range.
+	 * @param bValue - true if the artifact is collected.
+	 */
+	void Set(int32 Index, bool bValue);
+
+	/**
+	 * @brief Appends cleared bits, adding chunks as needed.
+	 * @details Authority only.
+	 *
+	 * @param Count - Number of bits to append.
+	 */
+	void AddBits(int32 Count);
+
+	/**
+	 * @brief Gets the underlying bit array.
+	 * @return The bits, one per collection index.
+	 */
+	FORCEINLINE const TBitArray<>& GetBits() const { return Bits; }
+
+	// FFastArraySerializer callbacks, copy received chunks into the bits
+	void PostReplicatedAdd(const TArrayView<int32>& AddedIndices, int32 FinalSize);
+	void PostReplicatedChange(const TArrayView<int32>& ChangedIndices, int32 FinalSize);
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FArtifactCollectionChunk, FArtifactCollectionBits>(Chunks, DeltaParms, *this);
+	}
+
+private:
+	/**
+	 * @brief Copies a received chunk into the bits, growing them if needed.
+	 * @param Chunk - The received chunk.
+	 */
+	void ApplyChunk(const FArtifactCollectionChunk& Chunk);
+
+private:
+	UPROPERTY()
+	TArray<FArtifactCollectionChunk> Chunks;
+
+	TBitArray<> Bits;
+};
+
+template<>
+struct TStructOpsTypeTraits<FArtifactCollectionBits> : public TStructOpsTypeTraitsBase2<FArtifactCollectionBits>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true
+	};
+};
+
+/**
+ * @brief Contiguous range of collection indices reserved for one level.
+ */
+USTRUCT()
+struct FArtifactCollectionLevelBlock
+{
+	GENERATED_BODY()
+
+	// Level package name without the PIE prefix
+	UPROPERTY()
+	FName LevelName;
+
+	UPROPERTY()
+	int32 FirstIndex = 0;
+
+	UPROPERTY()
+	int32 Num = 0;
+};
+
+/**
+ * @brief Replicated actor holding the collected state of every level-placed managed artifact.
+ * @details Spawned on the server by UArtifactCollectionSubsystem. Replaces one actor channel per
+ * artifact with a single always relevant actor that sends only the bitfield chunks that changed.
+ */
+UCLASS(NotBlueprintable, NotPlaceable, Transient)
+class ANDERSON_TASK_API AArtifactCollectionManager : public AInfo
+{
+	GENERATED_BODY()
+
+public:
+	AArtifactCollectionManager();
+
+	/**
+	 * @brief Reserves the index block of a level, reusing the block reserved earlier if any.
+	 * @details Authority only. Blocks are never released, so a level streamed back in keeps its state.
+	 *
+	 * @param LevelName - Level package name without the PIE prefix.
+	 * @param Num - Number of managed artifacts in the level.
+	 * @return The first collection index of the block.
+	 */
+	int32 ReserveLevelBlock(FName LevelName, int32 Num);
+
+	/**
+	 * @brief Finds the index block of a level.
+	 *
+	 * @param LevelName - Level package name without the PIE prefix.
+	 * @param OutNum - Receives the number of indices in the block.
+	 * @return The first collection index of the block, INDEX_NONE if not reserved yet.
+	 */
+	int32 FindLevelBlock(FName LevelName, int32& OutNum) const;
+
+	/**
+	 * @brief Sets the collected state of an artifact.
+	 * @details Authority only. Out of range indices are ignored.
+	 *
+	 * @param Index - The collection index.
+	 * @param bCollected - true if the artifact is collected.
+	 */
+	void SetCollected(int32 Index, bool bCollected);
+
+	/**
+	 * @brief Checks the collected state of an artifact.
+	 * @param Index - The collection index.
+	 * @return true if collected, false if not or out of range.
+	 */
+	FORCEINLINE bool IsCollected(int32 Index) const
+	{
+		return CollectedBits.GetBits().IsValidIndex(Index) && CollectedBits.Get(Index);
+	}
+
+	/**
+	 * @brief Gets the collected bitfield.
+	 * @return The bits, one per collection index.
+	 */
+	FORCEINLINE const FArtifactCollectionBits& GetCollectedBits() const { return CollectedBits; }
+
+protected:
+	// Replication setup
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+private:
+	/**
+	 * @brief Forwards replicated state to the collection subsystem.
+	 */
+	UFUNCTION()
+	void OnRep_CollectionState();
+
+private:
+	UPROPERTY(ReplicatedUsing = OnRep_CollectionState)
+	TArray<FArtifactCollectionLevelBlock> LevelBlocks;
+
+	UPROPERTY(ReplicatedUsing = OnRep_CollectionState)
+	FArtifactCollectionBits CollectedBits;
+};
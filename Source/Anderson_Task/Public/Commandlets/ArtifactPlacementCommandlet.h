@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ArtifactPlacementCommandlet.generated.h"
+
+/**
+ * @brief Commandlet regenerating artifact placement assets headless.
+ * @details Loads a map, runs every AArtifactPlacementGenerator in it and saves their placement
+ * assets, the generators themselves and an AArtifactPlacementCell for every new non-empty asset.
+ * Placement cells already in the map pick up the new data. Returns non-zero if the map has no
+ * generator, or an asset or cell failed to spawn or save.
+ *
+ * Usage: UnrealEditor-Cmd Anderson_Task.uproject -run=ArtifactPlacement -Map=/Game/Maps/Task_Map [options]
+ *  -Generator=Name         Only the generator with this actor name or label.
+ *  -Seed=N                 Overrides every generator's seed.
+ */
+UCLASS()
+class ANDERSON_TASK_API UArtifactPlacementCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UArtifactPlacementCommandlet();
+
+	// UCommandlet interface
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "SkaterHeatmapCommandlet.generated.h"
+
+/**
+ * @brief Commandlet turning the collection analytics logs into per-map heatmaps.
+ * @details Groups the logs in the input directory by map and writes, per map, a CSV with every
+ * layer of FSkaterHeatmap, one PNG per layer and a CSV of the artifact placements that were never
+ * collected. Needs no world, so it runs on logs copied from any machine.
+ *
+ * Usage: UnrealEditor-Cmd Anderson_Task.uproject -run=SkaterHeatmap [options]
+ *  -Map=Name               Only this map; defaults to every map with logs.
+ *  -Input=Dir              Log directory, defaults to Saved/Analytics.
+ *  -Output=Dir             Output directory, defaults to Saved/Analytics/Heatmaps.
+ *  -CellSize=500           Cell size in world units, defaults to the one the logs were written with.
+ *  -NoPng                  Skips the PNG layers.
+ */
+UCLASS()
+class ANDERSON_TASK_API USkaterHeatmapCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	USkaterHeatmapCommandlet();
+
+	// UCommandlet interface
+	virtual int32 Main(const FString& Params) override;
+};
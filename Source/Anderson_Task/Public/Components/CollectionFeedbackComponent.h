@@ -2,16 +2,15 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Subsystems/FeedbackPoolSubsystem.h"
 #include "CollectionFeedbackComponent.generated.h"
 
 class UArtifactData;
-class UAudioComponent;
-class UNiagaraComponent;
-class UParticleSystemComponent;
 
 /**
  * @brief Component to handle feedback effects when an artifact is collected.
  * @details Plays audio and visual effects based on the provided artifact data.
+ * Components are borrowed from the world feedback pool rather than spawned per pickup.
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class ANDERSON_TASK_API UCollectionFeedbackComponent : public UActorComponent
@@ -19,6 +18,13 @@ class ANDERSON_TASK_API UCollectionFeedbackComponent : public UActorComponent
 	GENERATED_BODY()
 
 public:
+	/** 
+	 * @brief Pre-warms pooled feedback components for the artifact data.
+	 * 
+	 * @param Data - The artifact data whose feedback will be played later.
+	 */
+	void PrewarmFeedback(const UArtifactData* Data);
+
 	/** 
 	 * @brief Plays feedback effects based on the artifact data.
 	 * 
@@ -39,15 +45,15 @@ private:
 	 */
 	void ScheduleStop(float Duration);
 
-protected:
-	UPROPERTY()
-	UAudioComponent* AudioComp = nullptr;
-
-	UPROPERTY()
-	UNiagaraComponent* NiagaraComp = nullptr;
+	/** 
+	 * @brief Gets the world feedback pool.
+	 * @return The feedback pool, or nullptr outside game worlds.
+	 */
+	UFeedbackPoolSubsystem* GetFeedbackPool() const;
 
-	UPROPERTY()
-	UParticleSystemComponent* ParticleComp = nullptr;
+protected:
+	// Pooled components currently playing for this owner
+	FCollectionFeedbackHandle ActiveFeedback;
 
 	FTimerHandle StopTimerHandle;
 };
@@ -0,0 +1,249 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "SkaterInputRecorderComponent.generated.h"
+
+class ASkaterCharacterBase;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSkaterInputRecorder, Log, All);
+
+/**
+ * One recorded input frame.
+ */
+struct FSkaterInputFrame
+{
+	enum EButtons : uint8
+	{
+		JumpPressed  = 1 << 0,
+		JumpReleased = 1 << 1
+	};
+
+	// Seconds since the start of the recording
+	float Time = 0.f;
+
+	// Move action value, X steering and Y throttle; stored quantised to int16
+	FVector2f Move = FVector2f::ZeroVector;
+
+	// Look action values summed over the frame
+	FVector2f Look = FVector2f::ZeroVector;
+
+	// EButtons edges seen during the frame
+	uint8 Buttons = 0;
+
+	friend FArchive& operator<<(FArchive& Ar, FSkaterInputFrame& Frame);
+};
+
+/**
+ * @brief A recorded input session.
+ * @details Stored as a small header followed by 17 bytes per frame:
+ * float time, int16 x2 move, float x2 look, uint8 buttons.
+ */
+struct ANDERSON_TASK_API FSkaterInputRecording
+{
+	static constexpr uint32 Magic = 0x52494B53; // "SKIR"
+	static constexpr uint16 Version = 1;
+
+	// Frames sorted by time
+	TArray<FSkaterInputFrame> Frames;
+
+	/**
+	 * @brief Gets the length of the recording.
+	 * @return Time of the last frame in seconds.
+	 */
+	FORCEINLINE float GetDuration() const { return Frames.Num() > 0 ? Frames.Last().Time : 0.f; }
+
+	/**
+	 * @brief Writes the recording in the binary format.
+	 * @param Path - Output file.
+	 * @return true on success.
+	 */
+	bool SaveToFile(const FString& Path) const;
+
+	/**
+	 * @brief Reads a recording written by SaveToFile.
+	 * @param Path - Input file.
+	 * @return true if the file is a valid recording with at least one frame.
+	 */
+	bool LoadFromFile(const FString& Path);
+
+	friend FArchive& operator<<(FArchive& Ar, FSkaterInputRecording& Recording);
+};
+
+/**
+ * @brief Records a skater's input per frame and replays it deterministically.
+ * @details While recording, the owning character reports its Enhanced Input values and the
+ * component stores one frame per tick. Replay advances a clock in fixed ReplayTimestep steps and
+ * consumes every recorded frame the steps cover, then hands the result to the skater once per
+ * tick: the latest move value, the summed look input and the oldest pending jump edge. Jump edges
+ * are queued and applied one per tick, so a press and release recorded close together are never
+ * cancelled before movement sees them. The skater still samples input once per tick, so a route
+ * only replays exactly at the frame rate it was recorded at; run benchmarks with a fixed engine
+ * frame rate (e.g. -benchmark -fps=60).
+ *
+ * -SkaterRecordInput=Path records the local player for the whole session;
+ * -SkaterReplayInput=Path replays a recording into the local player in a loop.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class ANDERSON_TASK_API USkaterInputRecorderComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	USkaterInputRecorderComponent();
+
+	// UActorComponent interface
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/**
+	 * @brief Starts or replays from the command line, if requested.
+	 * @details Called by the owner once it is locally controlled.
+	 */
+	void ApplyCommandLine();
+
+	/**
+	 * @brief Starts recording, discarding any previous recording.
+	 * @param SavePath - File written when recording stops; empty to keep the recording in memory.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Skater|Input")
+	void StartRecording(const FString& SavePath);
+
+	/**
+	 * @brief Stops recording and writes the file given to StartRecording.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Skater|Input")
+	void StopRecording();
+
+	/**
+	 * @brief Starts replaying a recording into the owner.
+	 *
+	 * @param InRecording - The recording to replay.
+	 * @param bInLoop - Whether to restart at the end.
+	 */
+	void StartReplay(const FSkaterInputRecording& InRecording, bool bInLoop);
+
+	/**
+	 * @brief Loads a recording and starts replaying it.
+	 *
+	 * @param Path - Recording file.
+	 * @param bInLoop - Whether to restart at the end.
+	 * @return true if the file was loaded.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Skater|Input")
+	bool StartReplayFromFile(const FString& Path, bool bInLoop);
+
+	/**
+	 * @brief Stops replaying and clears the replayed input.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Skater|Input")
+	void StopReplay();
+
+	/**
+	 * @brief Reports the Move action value.
+	 * @param Value - The value, zero on release.
+	 */
+	void RecordMoveInput(const FVector2D& Value);
+
+	/**
+	 * @brief Reports a Look action value.
+	 * @param Value - The value as received from Enhanced Input.
+	 */
+	void RecordLookInput(const FVector2D& Value);
+
+	/**
+	 * @brief Reports a Jump press or release.
+	 * @param bPressed - true for press, false for release.
+	 */
+	void RecordJumpInput(bool bPressed);
+
+	UFUNCTION(BlueprintPure, Category = "Skater|Input")
+	FORCEINLINE bool IsRecording() const { return bRecording; }
+
+	UFUNCTION(BlueprintPure, Category = "Skater|Input")
+	FORCEINLINE bool IsReplaying() const { return bReplaying; }
+
+	/**
+	 * @brief Gets the recording being made or replayed.
+	 * @return The recording.
+	 */
+	FORCEINLINE const FSkaterInputRecording& GetRecording() const { return Recording; }
+
+private:
+	/**
+	 * @brief Stores the input gathered this frame.
+	 */
+	void RecordFrame();
+
+	/**
+	 * @brief Advances the replay clock in fixed steps, consuming the frames they cover, and applies
+	 * the result to the owner.
+	 * @param DeltaTime - Time elapsed since the last tick.
+	 */
+	void AdvanceReplay(float DeltaTime);
+
+	/**
+	 * @brief Applies this tick's replayed input to the owner.
+	 *
+	 * @param Look - Look input summed over the consumed frames.
+	 * @param Edge - One EButtons edge, or 0.
+	 */
+	void ApplyReplayInput(const FVector2D& Look, uint8 Edge) const;
+
+	/**
+	 * @brief Turns ticking on while recording or replaying.
+	 */
+	void UpdateTickEnabled();
+
+	/**
+	 * @brief Gets the owning skater.
+	 * @return The owner, or nullptr if it is not a skater.
+	 */
+	ASkaterCharacterBase* GetSkater() const;
+
+public:
+	// Replay clock step in seconds
+	UPROPERTY(EditDefaultsOnly, Category = "Replay", meta = (ClampMin = "0.001"))
+	float ReplayTimestep = 1.f / 60.f;
+
+	// Upper bound on replay steps per tick, so a hitch does not stall the game thread
+	UPROPERTY(EditDefaultsOnly, Category = "Replay", meta = (ClampMin = "1"))
+	int32 MaxReplayStepsPerTick = 8;
+
+private:
+	FSkaterInputRecording Recording;
+
+	// File written when recording stops
+	FString RecordingPath;
+
+	// Input gathered since the last recorded frame ---------------------
+	FVector2f PendingMove = FVector2f::ZeroVector;
+
+	FVector2f PendingLook = FVector2f::ZeroVector;
+
+	uint8 PendingButtons = 0;
+
+	// World time at which recording started
+	double RecordingStartTime = 0.0;
+
+	// Replay state ---------------------------------------------------
+	// Replay clock in seconds, advanced in ReplayTimestep steps
+	double ReplayTime = 0.0;
+
+	float ReplayAccumulator = 0.f;
+
+	// Next frame to apply
+	int32 ReplayFrameIndex = 0;
+
+	// Move value of the last consumed frame
+	FVector2D ReplayMove = FVector2D::ZeroVector;
+
+	// Jump edges consumed but not applied yet, oldest first
+	TArray<uint8> PendingReplayEdges;
+
+	bool bRecording = false;
+
+	bool bReplaying = false;
+
+	bool bLoop = false;
+};
@@ -0,0 +1,276 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Characters/SkaterCharacterBase.h"
+#include "SkaterMovementComponent.generated.h"
+
+/**
+ * Custom movement modes used by skaters, stored in CustomMovementMode while in MOVE_Custom.
+ */
+UENUM(BlueprintType)
+enum class ESkaterCustomMovementMode : uint8
+{
+	None   UMETA(Hidden),
+	Skate  UMETA(DisplayName = "Skate")
+};
+
+/**
+ * @brief Network move data carrying the quantised steering input of a skater move.
+ */
+class FSkaterNetworkMoveData : public FCharacterNetworkMoveData
+{
+	using Super = FCharacterNetworkMoveData;
+
+public:
+	virtual void ClientFillNetworkMoveData(const FSavedMove_Character& ClientMove, ENetworkMoveType MoveType) override;
+	virtual bool Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap,
+		ENetworkMoveType MoveType) override;
+
+	// Steering input in 1/127 steps, see USkaterMovementComponent::QuantizeSteerInput
+	int8 SteerInput = 0;
+};
+
+/**
+ * @brief Move data container allocating skater network move data.
+ */
+class FSkaterNetworkMoveDataContainer : public FCharacterNetworkMoveDataContainer
+{
+public:
+	FSkaterNetworkMoveDataContainer();
+
+private:
+	FSkaterNetworkMoveData SkaterDefaultMoveData[3];
+};
+
+/**
+ * @brief Character movement component implementing skating as a native custom movement mode.
+ * @details Steering, acceleration, braking and coasting are integrated inside PhysCustom, so they
+ * are predicted on the owning client and replayed on correction like any other movement.
+ * Acceleration and braking intent travel to the server in the saved move's compressed custom flags,
+ * analog steering as a quantised byte in the custom network move data.
+ */
+UCLASS()
+class ANDERSON_TASK_API USkaterMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+	friend class FSavedMove_Skater;
+
+public:
+	USkaterMovementComponent();
+
+	// UCharacterMovementComponent interface
+	virtual bool IsMovingOnGround() const override;
+	virtual float GetMaxSpeed() const override;
+	virtual float GetMaxBrakingDeceleration() const override;
+	virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+
+	/**
+	 * @brief Sets the skate input used by the next simulated moves.
+	 * @details X is steering (-1 left, +1 right), Y is acceleration (+1 forward, -1 brake).
+	 * Steering keeps its analog value, quantised to a byte; acceleration and braking are reduced
+	 * to digital intent flags since they only select the movement state.
+	 *
+	 * @param Input - The raw movement input.
+	 */
+	void SetSkateInput(const FVector2D& Input);
+
+	/**
+	 * @brief Forces the acceleration intent to match a movement state.
+	 * @param NewState - The requested movement state.
+	 */
+	void SetRequestedSkateState(ESkaterMovementState NewState);
+
+	/**
+	 * @brief Checks if the component is in the skate movement mode.
+	 * @return true while skating.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Skater|Movement")
+	bool IsSkating() const;
+
+	/**
+	 * @brief Gets the movement state resolved by the last simulated move.
+	 * @return The current skate state.
+	 */
+	FORCEINLINE ESkaterMovementState GetSkateState() const { return SkateState; }
+
+	/**
+	 * @brief Hands steering to an external updater such as USkaterMovementBatchSubsystem.
+	 * @details While set, the skate mode no longer steers; ApplyExternalSteering must be called.
+	 *
+	 * @param bExternal - Whether steering is driven externally.
+	 */
+	void SetSteeringDrivenExternally(bool bExternal);
+
+	/**
+	 * @brief Applies a steering step solved outside the component.
+	 *
+	 * @param TurnValue - The interpolated turn value.
+	 * @param YawDelta - Yaw to rotate the skater and its velocity by, in degrees.
+	 */
+	void ApplyExternalSteering(float TurnValue, float YawDelta);
+
+	/**
+	 * @brief Runs one steering step from the current steering input.
+	 * @details Called by the skate mode; public so the per-actor path can be benchmarked.
+	 *
+	 * @param DeltaTime - Simulation step.
+	 */
+	void ApplySteering(float DeltaTime);
+
+	/**
+	 * @brief Quantises a steering input to the byte sent with each move.
+	 * @param Steer - Steering input, -1 left to +1 right.
+	 * @return The input in 1/127 steps, 0 inside the deadzone.
+	 */
+	static FORCEINLINE int8 QuantizeSteerInput(float Steer)
+	{
+		return FMath::Abs(Steer) > InputDeadzone
+			? static_cast<int8>(FMath::RoundToInt(FMath::Clamp(Steer, -1.f, 1.f) * 127.f))
+			: 0;
+	}
+
+	/**
+	 * @brief Gets the target turn value of a movement input.
+	 * @details Goes through the same quantisation as networked moves so every path steers alike.
+	 *
+	 * @param Input - X for steering, Y for acceleration/braking.
+	 * @return The target turn value in [-1, 1].
+	 */
+	static FORCEINLINE float GetTargetTurn(const FVector2D& Input)
+	{
+		return QuantizeSteerInput(Input.X) / 127.f;
+	}
+
+	/**
+	 * @brief Interpolates a turn value towards its target.
+	 *
+	 * @param CurrentTurn - The current turn value.
+	 * @param TargetTurn - The target turn value.
+	 * @param DeltaTime - Simulation step.
+	 * @param InterpSpeed - Steering interpolation speed.
+	 * @return The new turn value.
+	 */
+	static FORCEINLINE float StepTurnValue(float CurrentTurn, float TargetTurn, float DeltaTime, float InterpSpeed)
+	{
+		return FMath::FInterpTo(CurrentTurn, TargetTurn, DeltaTime, InterpSpeed);
+	}
+
+protected:
+	// UCharacterMovementComponent interface
+	virtual void OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode) override;
+	virtual void PhysCustom(float DeltaTime, int32 Iterations) override;
+	virtual void UpdateFromCompressedFlags(uint8 Flags) override;
+	virtual void MoveAutonomous(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags,
+		const FVector& NewAccel) override;
+
+private:
+	/**
+	 * @brief Runs one skate simulation step.
+	 * @details Resolves the movement state, applies steering, then integrates ground movement
+	 * with the braking deceleration of the current state.
+	 *
+	 * @param DeltaTime - Simulation step.
+	 * @param Iterations - Physics iteration count.
+	 */
+	void PhysSkate(float DeltaTime, int32 Iterations);
+
+	/**
+	 * @brief Rotates the skater and its velocity around the up axis.
+	 * @param YawDelta - Rotation in degrees.
+	 */
+	void ApplyYawDelta(float YawDelta);
+
+	/**
+	 * @brief Resolves the skate state from the intent flags.
+	 */
+	void UpdateSkateState();
+
+public:
+	// Steering and deceleration tuning, pushed from the owning skater -----
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Skating", meta = (ClampMin = "0.0"))
+	float TurnRate = 100.f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Skating", meta = (ClampMin = "0.0"))
+	float SteeringInterpSpeed = 5.0f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Skating", meta = (ClampMin = "0.0"))
+	float AccelerateDeceleration = 100.f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Skating", meta = (ClampMin = "0.0"))
+	float BrakeDeceleration = 2048.f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Skating", meta = (ClampMin = "0.0"))
+	float CoastDeceleration = 50.f;
+
+	// Use the skate mode whenever the skater would otherwise walk
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Skating")
+	bool bSkateOnGround = true;
+
+	// Minimum stick deflection to register steering, acceleration or braking
+	static constexpr float InputDeadzone = 0.1f;
+
+	// Minimum turn value to apply rotation (prevents micro-jitter)
+	static constexpr float TurnDeadzone = 0.01f;
+
+private:
+	// Intent flags, sent to the server in FLAG_Custom_0..1
+	uint8 bWantsAccelerate : 1;
+	uint8 bWantsBrake : 1;
+
+	// Quantised steering input, sent to the server in FSkaterNetworkMoveData
+	int8 SteerInput = 0;
+
+	// Current turn value for steering interpolation
+	float CurrentTurnValue = 0.f;
+
+	// Steering is solved by an external batch instead of the skate mode
+	bool bSteeringDrivenExternally = false;
+
+	ESkaterMovementState SkateState = ESkaterMovementState::Coasting;
+
+	FSkaterNetworkMoveDataContainer SkaterMoveDataContainer;
+};
+
+/**
+ * @brief Saved move carrying the skate intent flags and steering state.
+ */
+class FSavedMove_Skater : public FSavedMove_Character
+{
+	using Super = FSavedMove_Character;
+
+	friend class FSkaterNetworkMoveData;
+
+public:
+	FSavedMove_Skater();
+
+	virtual void Clear() override;
+	virtual uint8 GetCompressedFlags() const override;
+	virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override;
+	virtual void SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel,
+		FNetworkPredictionData_Client_Character& ClientData) override;
+	virtual void PrepMoveFor(ACharacter* C) override;
+
+private:
+	uint8 bSavedAccelerate : 1;
+	uint8 bSavedBrake : 1;
+
+	int8 SavedSteerInput = 0;
+
+	// Turn value at the start of the move, restored before replays
+	float SavedTurnValue = 0.f;
+};
+
+/**
+ * @brief Client prediction data allocating skater saved moves.
+ */
+class FNetworkPredictionData_Client_Skater : public FNetworkPredictionData_Client_Character
+{
+	using Super = FNetworkPredictionData_Client_Character;
+
+public:
+	explicit FNetworkPredictionData_Client_Skater(const UCharacterMovementComponent& ClientMovement);
+
+	virtual FSavedMovePtr AllocateNewMove() override;
+};
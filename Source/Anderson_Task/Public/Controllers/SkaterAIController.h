@@ -0,0 +1,127 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AIController.h"
+#include "SkaterAIController.generated.h"
+
+class ASkaterCharacterBase;
+class USplineComponent;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSkaterAI, Log, All);
+
+/**
+ * @brief AI controller driving a skater through SetMovementInput.
+ * @details Every DecisionInterval the controller picks a goal: the nearest artifact from the
+ * artifact registry within ArtifactSearchRadius, reached over the navmesh when one exists, or
+ * otherwise the point LookAheadDistance further along its route spline. Every tick it turns the
+ * goal into steering and throttle input, the same input a player produces, so bots exercise
+ * collection, scoring and replication exactly like humans. Decisions are staggered and skaters
+ * are batched, so hundreds of bots can run on a headless server.
+ */
+UCLASS(Config = Game)
+class ANDERSON_TASK_API ASkaterAIController : public AAIController
+{
+	GENERATED_BODY()
+
+public:
+	ASkaterAIController();
+
+	virtual void Tick(float DeltaTime) override;
+
+	/**
+	 * @brief Sets the spline followed while no artifact is in reach.
+	 * @param InRoute - The route, or nullptr to stop when idle.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Skater|AI")
+	void SetRoute(USplineComponent* InRoute);
+
+protected:
+	/**
+	 * @brief Takes control of a skater and moves it into the movement batch if enabled.
+	 * @param InPawn - The possessed pawn.
+	 */
+	virtual void OnPossess(APawn* InPawn) override;
+
+	/**
+	 * @brief Releases the skater, clearing its input.
+	 */
+	virtual void OnUnPossess() override;
+
+private:
+	/**
+	 * @brief Picks the current goal: nearest artifact, else the route.
+	 */
+	void UpdateGoal();
+
+	/**
+	 * @brief Builds the path to a new artifact target.
+	 * @param TargetLocation - The artifact's location.
+	 */
+	void BuildPathTo(const FVector& TargetLocation);
+
+	/**
+	 * @brief Gets the point to steer at this tick.
+	 * @param OutGoal - Receives the point.
+	 * @return false if the skater has nowhere to go.
+	 */
+	bool GetSteeringGoal(FVector& OutGoal);
+
+	/**
+	 * @brief Converts a goal point into skater input.
+	 *
+	 * @param Skater - The controlled skater.
+	 * @param Goal - Point to steer at.
+	 * @return X steering, Y throttle.
+	 */
+	FVector2D ComputeInput(const ASkaterCharacterBase* Skater, const FVector& Goal) const;
+
+public:
+	// Seconds between goal decisions
+	UPROPERTY(Config, EditAnywhere, Category = "Skater|AI", meta = (ClampMin = "0.05"))
+	float DecisionInterval = 0.5f;
+
+	// Maximum distance to an artifact worth seeking
+	UPROPERTY(Config, EditAnywhere, Category = "Skater|AI", meta = (ClampMin = "0.0"))
+	float ArtifactSearchRadius = 3000.f;
+
+	// Distance at which a path point counts as reached
+	UPROPERTY(Config, EditAnywhere, Category = "Skater|AI", meta = (ClampMin = "0.0"))
+	float AcceptanceRadius = 150.f;
+
+	// Distance ahead along the route spline to steer at
+	UPROPERTY(Config, EditAnywhere, Category = "Skater|AI", meta = (ClampMin = "0.0"))
+	float LookAheadDistance = 600.f;
+
+	// Heading error in degrees that gives full steering
+	UPROPERTY(Config, EditAnywhere, Category = "Skater|AI", meta = (ClampMin = "1.0", ClampMax = "180.0"))
+	float FullSteeringAngle = 45.f;
+
+	// Heading error in degrees beyond which the skater stops accelerating
+	UPROPERTY(Config, EditAnywhere, Category = "Skater|AI", meta = (ClampMin = "0.0", ClampMax = "180.0"))
+	float CoastAngle = 100.f;
+
+	// Whether paths to artifacts use the navmesh
+	UPROPERTY(Config, EditAnywhere, Category = "Skater|AI")
+	bool bUseNavigation = true;
+
+	// Whether controlled skaters update steering in the movement batch
+	UPROPERTY(Config, EditAnywhere, Category = "Skater|AI")
+	bool bUseBatchedMovement = true;
+
+private:
+	// Spline followed while no artifact is in reach
+	TWeakObjectPtr<USplineComponent> Route;
+
+	// Artifact being sought
+	TWeakObjectPtr<AActor> TargetArtifact;
+
+	// Location TargetArtifact had when the path was built; pooled artifacts move when recycled
+	FVector TargetArtifactLocation = FVector::ZeroVector;
+
+	// Path to TargetArtifact, the artifact itself last
+	TArray<FVector> PathPoints;
+
+	int32 PathIndex = 0;
+
+	float DecisionAccumulator = 0.f;
+};
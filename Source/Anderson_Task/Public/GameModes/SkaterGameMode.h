@@ -6,7 +6,8 @@
 
 /**
  * @brief Game mode class for the Skater game.
- * @details This class sets the default pawn to the SkaterPlayerCharacter Blueprint.
+ * @details This class sets the default pawn to the SkaterPlayerCharacter Blueprint and uses
+ * ASkaterGameState for the leaderboard. Each match is recorded as a telemetry session.
  */
 UCLASS(minimalapi)
 class ASkaterGameMode : public AGameModeBase
@@ -23,6 +24,17 @@ protected:
 	 */
 	virtual void PostInitProperties() override;
 
+	/**
+	 * @brief Starts the match and its telemetry session.
+	 */
+	virtual void StartPlay() override;
+
+	/**
+	 * @brief Ends the match's telemetry session, writing its summary.
+	 * @param EndPlayReason - Why the game mode is being removed.
+	 */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	/**
 	 * @brief Default character class.
 	 * @details Specifies the character class to use as the default pawn.
@@ -0,0 +1,202 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/GameStateBase.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "UObject/ObjectKey.h"
+#include "SkaterGameState.generated.h"
+
+class APlayerState;
+class ASkaterGameState;
+class ASkaterPlayerState;
+
+DECLARE_MULTICAST_DELEGATE(FOnLeaderboardChanged);
+
+/**
+ * @brief Leaderboard row returned by the ranking queries.
+ */
+USTRUCT(BlueprintType)
+struct FSkaterLeaderboardRow
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Leaderboard")
+	TObjectPtr<APlayerState> PlayerState = nullptr;
+
+	// 1-based rank
+	UPROPERTY(BlueprintReadOnly, Category = "Leaderboard")
+	int32 Rank = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Leaderboard")
+	int32 Points = 0;
+};
+
+/**
+ * @brief Replicated rank of one player.
+ */
+USTRUCT()
+struct FSkaterRankItem : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<APlayerState> PlayerState = nullptr;
+
+	// 1-based rank, 0 until ranked
+	UPROPERTY()
+	int32 Rank = 0;
+
+	UPROPERTY()
+	int32 Points = 0;
+
+	// Server only tie-break, earlier joiners rank first
+	int32 JoinOrder = 0;
+};
+
+/**
+ * @brief Fast array of player ranks; only items whose rank or points changed are sent.
+ */
+USTRUCT()
+struct FSkaterRankList : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FSkaterRankItem> Items;
+
+	// Game state owning the list, notified after each received update
+	ASkaterGameState* Owner = nullptr;
+
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FSkaterRankItem, FSkaterRankList>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FSkaterRankList> : public TStructOpsTypeTraitsBase2<FSkaterRankList>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true
+	};
+};
+
+/**
+ * @brief Game state holding the server-authoritative leaderboard.
+ * @details The server keeps players sorted by points and re-inserts a player with a binary
+ * search whenever its committed points change, so no full sort ever runs. Only the players whose
+ * rank or points changed are marked dirty in the replicated fast array. Clients rebuild their
+ * order in linear time from the received ranks.
+ */
+UCLASS()
+class ANDERSON_TASK_API ASkaterGameState : public AGameStateBase
+{
+	GENERATED_BODY()
+
+public:
+	ASkaterGameState();
+
+	// AGameStateBase interface
+	virtual void AddPlayerState(APlayerState* PlayerState) override;
+	virtual void RemovePlayerState(APlayerState* PlayerState) override;
+
+	/**
+	 * @brief Gets the highest ranked players.
+	 * @param Count - Maximum number of rows.
+	 * @return Rows in rank order.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Leaderboard")
+	TArray<FSkaterLeaderboardRow> GetTopEntries(int32 Count) const;
+
+	/**
+	 * @brief Gets the players ranked around a player, the player included.
+	 *
+	 * @param PlayerState - The player at the centre.
+	 * @param Radius - Number of rows above and below.
+	 * @return Rows in rank order, empty if the player is unranked.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Leaderboard")
+	TArray<FSkaterLeaderboardRow> GetNeighbourhood(const APlayerState* PlayerState, int32 Radius) const;
+
+	/**
+	 * @brief Gets the rank of a player.
+	 * @param PlayerState - The player to look up.
+	 * @return 1-based rank, 0 if unranked.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Leaderboard")
+	int32 GetRank(const APlayerState* PlayerState) const;
+
+	/**
+	 * @brief Gets the number of ranked players.
+	 * @return Number of leaderboard rows.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Leaderboard")
+	FORCEINLINE int32 GetNumRanked() const { return RankedItems.Num(); }
+
+	/**
+	 * @brief Rebuilds the local order after the rank list replicated.
+	 */
+	void HandleRankListReplicated();
+
+protected:
+	// Replication setup
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+private:
+	/**
+	 * @brief Re-inserts a player after its committed points changed.
+	 */
+	void HandlePointsChanged(ASkaterPlayerState* PlayerState, int32 OldPoints, int32 NewPoints);
+
+	/**
+	 * @brief Checks if item A ranks ahead of item B.
+	 */
+	bool RanksAhead(int32 ItemA, int32 ItemB) const;
+
+	/**
+	 * @brief Finds the position of an item in RankedItems by binary search on its current key.
+	 * @param ItemIndex - Index into the rank list items.
+	 * @return Position in RankedItems.
+	 */
+	int32 FindRankedPosition(int32 ItemIndex) const;
+
+	/**
+	 * @brief Inserts an item into RankedItems at its sorted position.
+	 * @param ItemIndex - Index into the rank list items.
+	 * @return The insert position.
+	 */
+	int32 InsertRanked(int32 ItemIndex);
+
+	/**
+	 * @brief Writes ranks for a range of positions, marking changed items dirty.
+	 *
+	 * @param First - First position to refresh.
+	 * @param Last - Last position to refresh, inclusive.
+	 */
+	void RefreshRanks(int32 First, int32 Last);
+
+	/**
+	 * @brief Builds a row for the item at a ranked position.
+	 */
+	FSkaterLeaderboardRow MakeRow(int32 Position) const;
+
+public:
+	// Broadcast when ranks or points on the leaderboard changed, on server and clients
+	FOnLeaderboardChanged OnLeaderboardChanged;
+
+private:
+	UPROPERTY(Replicated)
+	FSkaterRankList RankList;
+
+	// Item indices in rank order
+	TArray<int32> RankedItems;
+
+	// Player -> index into the rank list items
+	TMap<TObjectKey<APlayerState>, int32> ItemIndices;
+
+	// Next tie-break value handed to a joining player
+	int32 NextJoinOrder = 0;
+};
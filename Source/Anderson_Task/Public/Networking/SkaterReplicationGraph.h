@@ -0,0 +1,107 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "SkaterReplicationGraph.generated.h"
+
+class UReplicationGraphNode_ActorList;
+class UReplicationGraphNode_GridSpatialization2D;
+class UReplicationGraphNode_PlayerStateFrequencyLimiter;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSkaterReplicationGraph, Log, All);
+
+/**
+ * @brief How actors of a class are routed into the graph.
+ */
+enum class ESkaterRepNodeMapping : uint8
+{
+	// Not routed to a global node; owner-relevant actors reach their connection through its viewers
+	NotRouted,
+
+	// Sent to every connection
+	RelevantAllConnections,
+
+	// Spatialized once, never moves
+	Spatialize_Static,
+
+	// Spatialized and re-bucketed every frame
+	Spatialize_Dynamic,
+
+	// Treated as static while dormant, dynamic while awake
+	Spatialize_Dormancy
+};
+
+/**
+ * @brief Replication graph for skater sessions.
+ * @details Replaces per-connection relevancy checks of every actor with shared node lists:
+ *  - Skaters and artifacts live in a 2D spatial grid and are culled by distance per class.
+ *    Grid cells use dynamic spatial frequency, so distant skaters replicate less often.
+ *  - Dormant artifacts sit in the grid's static lists and cost nothing until woken.
+ *  - Player states are rate limited across connections instead of all replicating each frame.
+ *  - Always relevant actors (game state, collection manager) are gathered once per frame.
+ *
+ * Enabled through ReplicationDriverClassName on the net driver in DefaultEngine.ini.
+ */
+UCLASS(Transient, Config = Engine)
+class ANDERSON_TASK_API USkaterReplicationGraph : public UReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+	// UReplicationGraph interface
+	virtual void InitGlobalActorClassSettings() override;
+	virtual void InitGlobalGraphNodes() override;
+	virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection) override;
+	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+
+private:
+	/**
+	 * @brief Gets the routing of an actor class, deriving it from the class defaults if unset.
+	 * @param Class - The replicated actor class.
+	 * @return How actors of the class are routed.
+	 */
+	ESkaterRepNodeMapping GetMappingPolicy(const UClass* Class);
+
+	/**
+	 * @brief Registers the replication period and cull distance of a class.
+	 *
+	 * @param Class - The replicated actor class.
+	 * @param CullDistance - Distance beyond which the class is not replicated, 0 for no culling.
+	 */
+	void InitClassReplicationInfo(UClass* Class, float CullDistance);
+
+public:
+	// Edge length of one grid cell in world units
+	UPROPERTY(Config)
+	float GridCellSize = 10000.f;
+
+	// Grid origin offset; the grid covers positive cells only, so this should lie below the map bounds
+	UPROPERTY(Config)
+	FVector2D SpatialBias = FVector2D(-200000.f, -200000.f);
+
+	// Distance beyond which skaters are not replicated
+	UPROPERTY(Config)
+	float SkaterCullDistance = 15000.f;
+
+	// Distance beyond which individually replicated artifacts are not replicated
+	UPROPERTY(Config)
+	float ArtifactCullDistance = 8000.f;
+
+	// Lower the update rate of skaters by distance and view direction
+	UPROPERTY(Config)
+	bool bEnableDynamicSpatialFrequency = true;
+
+private:
+	// Routing per actor class, inherited by subclasses
+	TClassMap<ESkaterRepNodeMapping> ClassRepNodePolicies;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_GridSpatialization2D> GridNode;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_ActorList> AlwaysRelevantNode;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_PlayerStateFrequencyLimiter> PlayerStateNode;
+};
@@ -5,11 +5,40 @@
 #include "Interfaces/PointSystem.h"
 #include "SkaterPlayerState.generated.h"
 
+class ASkaterPlayerState;
+
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnPointsChangedNative, ASkaterPlayerState* /*PlayerState*/, int32 /*OldPoints*/, int32 /*NewPoints*/);
+
+/**
+ * @brief One score change recorded by the points ledger.
+ */
+USTRUCT(BlueprintType)
+struct FSkaterScoreEvent
+{
+	GENERATED_BODY()
+
+	// What awarded the points, e.g. the collected artifact's name; None if unknown
+	UPROPERTY(BlueprintReadOnly, Category = "Points")
+	FName SourceId;
+
+	// Points added (negative for deductions)
+	UPROPERTY(BlueprintReadOnly, Category = "Points")
+	int32 Delta = 0;
+
+	// World time of the change in seconds
+	UPROPERTY(BlueprintReadOnly, Category = "Points")
+	double Timestamp = 0.0;
+};
+
 /**
  * @brief The PlayerState class for the Skater game.
  * @details Manages player-specific data such as points. 
  * Implements the IPointSystem interface.
  * Follows SOLID principles by separating point management into its own class.
+ * 
+ * Points are kept in a ledger: changes during a frame accumulate into a pending total that is
+ * committed once at end of frame, with one OnPointsChanged broadcast and one replication update.
+ * Each change is also recorded with its source in a bounded ring buffer on the server.
  */
 UCLASS()
 class ANDERSON_TASK_API ASkaterPlayerState : public APlayerState, public IPointSystem
@@ -25,16 +54,41 @@ public:
 
 	/**
 	 * @brief Adds points to the player's total.
+	 * @details The change is committed at end of frame; see AddPointsWithSource.
 	 * 
 	 * @param Points - Number of points to add (can be negative).
 	 * @return The new total points.
 	 */
     virtual int32 AddPoints_Implementation(int32 Points) override;
 
+	/**
+	 * @brief Adds points and records what awarded them.
+	 * @details Server only. The pending total is clamped at zero per call, as before batching.
+	 * 
+	 * @param Points - Number of points to add (can be negative).
+	 * @param SourceId - What awarded the points, recorded in the score history.
+	 * @return The new total points, including uncommitted changes.
+	 */
+	int32 AddPointsWithSource(int32 Points, FName SourceId);
+
+	/**
+	 * @brief Commits pending points now instead of at end of frame.
+	 * @details Updates CurrentPoints, marks it for replication and broadcasts OnPointsChanged once.
+	 */
+	void CommitPendingPoints();
+
+	/**
+	 * @brief Gets the most recent score events, oldest first.
+	 * @details Server only; clients see aggregated changes through OnPointsChanged.
+	 * @return Up to MaxScoreHistory events.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Points")
+	TArray<FSkaterScoreEvent> GetRecentScoreEvents() const;
+
 	/**
 	 * @brief Gets the current point total.
 	 * 
-	 * @return Current points.
+	 * @return Current points, including changes not yet committed this frame.
 	 */
     virtual int32 GetPoints_Implementation() const override;
 
@@ -55,11 +109,38 @@ protected:
 	// Replication setup
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
+	/**
+	 * @brief Called when the player state is removed from the world.
+	 * @details Commits pending points so no change is lost.
+	 * 
+	 * @param EndPlayReason - Why the player state is being removed.
+	 */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/**
+	 * @brief Records a score event in the ring buffer.
+	 */
+	void RecordScoreEvent(int32 Delta, FName SourceId);
+
+	/**
+	 * @brief Broadcasts a change of CurrentPoints to listeners and telemetry.
+	 * @param OldPoints - Points before the change.
+	 */
+	void BroadcastPointsChanged(int32 OldPoints);
+
+public:
+	// Number of recent score events kept for UI and auditing
+	UPROPERTY(EditDefaultsOnly, Category = "Points", meta = (ClampMin = "1"))
+	int32 MaxScoreHistory = 64;
+
 public:
 	// Delegate for point changes
 	UPROPERTY(BlueprintAssignable, Category = "Points")
 	FOnPointsChanged OnPointsChanged;
 
+	// Native counterpart of OnPointsChanged carrying the player state, for C++ listeners such as the leaderboard
+	FOnPointsChangedNative OnPointsChangedNative;
+
 private:
 	// Current points
 	UPROPERTY(ReplicatedUsing = OnRep_CurrentPoints)
@@ -68,4 +149,20 @@ private:
 	// Replication notification for CurrentPoints
 	UFUNCTION()
 	void OnRep_CurrentPoints(int32 OldPoints);
+
+	// Running total including uncommitted changes, valid while bHasPendingPoints
+	int32 PendingPoints = 0;
+
+	bool bHasPendingPoints = false;
+
+	// Commit callback bound for the current frame
+	FDelegateHandle EndFrameHandle;
+
+	// Score history ring buffer, allocated on first use
+	TArray<FSkaterScoreEvent> ScoreHistory;
+
+	// Next slot to write in ScoreHistory
+	int32 ScoreHistoryHead = 0;
+
+	int32 ScoreHistoryCount = 0;
 };
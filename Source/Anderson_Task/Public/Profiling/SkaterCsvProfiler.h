@@ -0,0 +1,11 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+/**
+ * CSV profiler categories for gameplay counters, written by USkaterTelemetrySubsystem each frame.
+ * Capture with -csvCaptureFrames=N, "CsvProfile Start" or a telemetry session.
+ */
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(ANDERSON_TASK_API, Skater);
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(ANDERSON_TASK_API, SkaterArtifacts);
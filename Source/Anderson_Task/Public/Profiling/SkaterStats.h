@@ -0,0 +1,16 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+/**
+ * Stat group for gameplay hot paths; view with "stat Skater". The cycle counters only appear as
+ * timing scopes in Unreal Insights when the capture runs with -statnamedevents (or "stat namedevents").
+ */
+DECLARE_STATS_GROUP(TEXT("Skater"), STATGROUP_Skater, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Skater Tick"), STAT_SkaterTick, STATGROUP_Skater, ANDERSON_TASK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Skater Batched Steering"), STAT_SkaterBatchedSteering, STATGROUP_Skater, ANDERSON_TASK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Artifact Collected"), STAT_ArtifactCollected, STATGROUP_Skater, ANDERSON_TASK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Collection Feedback"), STAT_CollectionFeedback, STATGROUP_Skater, ANDERSON_TASK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Skater HUD Tick"), STAT_SkaterHUDTick, STATGROUP_Skater, ANDERSON_TASK_API);
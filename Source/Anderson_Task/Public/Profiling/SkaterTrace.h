@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+
+#define SKATER_TRACE_ENABLED UE_TRACE_ENABLED
+
+#if SKATER_TRACE_ENABLED
+
+/**
+ * Trace channel for gameplay events. Off by default; enable it at launch with -trace=default,skater
+ * or at runtime with "Trace.Enable Skater".
+ */
+UE_TRACE_CHANNEL_EXTERN(SkaterChannel, ANDERSON_TASK_API);
+
+/**
+ * @brief Writes gameplay events to the Skater trace channel.
+ * @details Each call is a no-op while the channel is disabled. Objects are identified by their
+ * UObject unique ID, with the name attached so captures can be read without symbols.
+ */
+struct ANDERSON_TASK_API FSkaterTrace
+{
+	/**
+	 * @brief Traces an artifact collection.
+	 *
+	 * @param Artifact - The collected artifact.
+	 * @param Collector - The actor that collected it.
+	 * @param Points - Points awarded.
+	 */
+	static void OutputCollection(const UObject* Artifact, const UObject* Collector, int32 Points);
+
+	/**
+	 * @brief Traces a committed score change.
+	 *
+	 * @param PlayerState - The player whose score changed.
+	 * @param OldPoints - Points before the change.
+	 * @param NewPoints - Points after the change.
+	 */
+	static void OutputScore(const UObject* PlayerState, int32 OldPoints, int32 NewPoints);
+
+	/**
+	 * @brief Traces a skater movement state change.
+	 *
+	 * @param SkaterObject - The skater.
+	 * @param OldState - Previous ESkaterMovementState.
+	 * @param NewState - New ESkaterMovementState.
+	 */
+	static void OutputMovementState(const UObject* SkaterObject, uint8 OldState, uint8 NewState);
+};
+
+#define SKATER_TRACE_COLLECTION(Artifact, Collector, Points) FSkaterTrace::OutputCollection(Artifact, Collector, Points)
+#define SKATER_TRACE_SCORE(PlayerState, OldPoints, NewPoints) FSkaterTrace::OutputScore(PlayerState, OldPoints, NewPoints)
+#define SKATER_TRACE_MOVEMENT_STATE(Skater, OldState, NewState) FSkaterTrace::OutputMovementState(Skater, static_cast<uint8>(OldState), static_cast<uint8>(NewState))
+
+#else
+
+#define SKATER_TRACE_COLLECTION(Artifact, Collector, Points)
+#define SKATER_TRACE_SCORE(PlayerState, OldPoints, NewPoints)
+#define SKATER_TRACE_MOVEMENT_STATE(Skater, OldState, NewState)
+
+#endif
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "ArtifactCollectionSubsystem.generated.h"
+
+class APointArtifact;
+class AArtifactCollectionManager;
+class ULevel;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogArtifactCollection, Log, All);
+
+/**
+ * @brief World subsystem giving level-placed artifacts stable collection indices.
+ * @details Managed artifacts do not replicate individually. The managed artifacts of each level
+ * are sorted by name, which matches on every machine, and the server reserves one contiguous
+ * index block per level in the replicated AArtifactCollectionManager. Clients map the replicated
+ * blocks back onto their local artifacts and apply only the bits that changed.
+ */
+UCLASS()
+class ANDERSON_TASK_API UArtifactCollectionSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Deinitialize() override;
+
+	/**
+	 * @brief Registers a managed artifact.
+	 * @details The first artifact of a level builds the index table of that level.
+	 *
+	 * @param Artifact - The artifact to register. Must be a net startup actor.
+	 * @return The collection index of the artifact on the server, INDEX_NONE on clients or on failure.
+	 */
+	int32 RegisterArtifact(APointArtifact* Artifact);
+
+	/**
+	 * @brief Removes a managed artifact, e.g. when its level streams out.
+	 * @details The server keeps the level's block so its state survives re-streaming.
+	 *
+	 * @param Artifact - The artifact to unregister.
+	 */
+	void UnregisterArtifact(APointArtifact* Artifact);
+
+	/**
+	 * @brief Sets the replicated collected state of an artifact.
+	 * @details Authority only.
+	 *
+	 * @param Index - The collection index returned by RegisterArtifact.
+	 * @param bCollected - true if the artifact is collected.
+	 */
+	void SetCollected(int32 Index, bool bCollected);
+
+	/**
+	 * @brief Checks the collected state of an artifact.
+	 *
+	 * @param Index - The collection index returned by RegisterArtifact.
+	 * @return true if the artifact is marked collected.
+	 */
+	bool IsCollected(int32 Index) const;
+
+	/**
+	 * @brief Applies replicated manager state to local artifacts.
+	 * @details Called by the manager's OnRep on clients.
+	 *
+	 * @param InManager - The manager that received the state.
+	 */
+	void HandleManagerReplicated(AArtifactCollectionManager* InManager);
+
+	/**
+	 * @brief Gets the collection manager of this world.
+	 * @return The manager, nullptr until spawned or replicated.
+	 */
+	FORCEINLINE AArtifactCollectionManager* GetManager() const { return Manager; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	// Managed artifacts of one level in stable order
+	struct FLevelTable
+	{
+		// Level package name without the PIE prefix
+		FName LevelName;
+
+		// Artifact names sorted lexically, the local index of each artifact
+		TArray<FName> Names;
+
+		// Registered artifacts, parallel to Names
+		TArray<TWeakObjectPtr<APointArtifact>> Artifacts;
+
+		// First collection index, INDEX_NONE until the block is known
+		int32 FirstIndex = INDEX_NONE;
+
+		int32 NumRegistered = 0;
+	};
+
+	/**
+	 * @brief Checks if this world owns the collection state.
+	 * @return true on servers and standalone games.
+	 */
+	bool IsAuthority() const;
+
+	/**
+	 * @brief Gets the manager, spawning it on the authority.
+	 * @return The manager, nullptr on clients before it replicated.
+	 */
+	AArtifactCollectionManager* GetOrSpawnManager();
+
+	/**
+	 * @brief Finds the table of a level, building it from the level's actors on first use.
+	 * @param Level - The level of a managed artifact.
+	 * @return The table, nullptr if the level has no managed artifacts.
+	 */
+	FLevelTable* FindOrBuildLevelTable(ULevel* Level);
+
+	/**
+	 * @brief Finds the local index of an artifact inside its level table.
+	 *
+	 * @param Table - The level table.
+	 * @param Artifact - The artifact to look up.
+	 * @return The local index, INDEX_NONE if the artifact is not part of the table.
+	 */
+	static int32 FindLocalIndex(const FLevelTable& Table, const APointArtifact* Artifact);
+
+	/**
+	 * @brief Resolves the replicated block of a level on a client and applies its state.
+	 * @param Table - The table to map. Left unmapped if the block is unknown or mismatched.
+	 */
+	void MapLevelTable(FLevelTable& Table);
+
+	/**
+	 * @brief Applies every bit that changed since the last replicated state.
+	 */
+	void ApplyChangedBits();
+
+private:
+	TMap<TObjectKey<ULevel>, FLevelTable> LevelTables;
+
+	// Client: collection index -> local artifact
+	TArray<TWeakObjectPtr<APointArtifact>> ArtifactsByIndex;
+
+	// Client: last bitfield applied to local artifacts
+	TBitArray<> AppliedBits;
+
+	UPROPERTY(Transient)
+	TObjectPtr<AArtifactCollectionManager> Manager;
+};
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "ArtifactPlacementSubsystem.generated.h"
+
+class AArtifactPlacementCell;
+class APointArtifact;
+class ASkaterCharacterBase;
+class UArtifactPlacementData;
+
+/**
+ * @brief World subsystem remembering which streamed artifact placements were collected.
+ * @details Collected state is kept per placement asset as a bit array, keyed by the asset path so
+ * it survives the asset being unloaded with its cell. Placements of artifact types that respawn
+ * are never marked. Also maps each materialised artifact back to its cell and placement.
+ * Server only.
+ */
+UCLASS()
+class ANDERSON_TASK_API UArtifactPlacementSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// UWorldSubsystem interface
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * @brief Checks if a placement was collected.
+	 *
+	 * @param Data - The placement asset.
+	 * @param PlacementIndex - The placement index.
+	 * @return true if the placement was collected and should not be materialised again.
+	 */
+	bool IsCollected(const UArtifactPlacementData* Data, int32 PlacementIndex) const;
+
+	/**
+	 * @brief Associates a materialised artifact with its placement.
+	 *
+	 * @param Artifact - The artifact acquired for the placement.
+	 * @param Cell - The cell owning the placement.
+	 * @param PlacementIndex - The placement index.
+	 */
+	void TrackArtifact(APointArtifact* Artifact, AArtifactPlacementCell* Cell, int32 PlacementIndex);
+
+	/**
+	 * @brief Forgets a materialised artifact.
+	 * @param Artifact - The artifact being returned to the pool.
+	 */
+	void UntrackArtifact(const APointArtifact* Artifact);
+
+	/**
+	 * @brief Gets the number of collected placements across every cell.
+	 * @return Number of collected placements.
+	 */
+	FORCEINLINE int32 GetNumCollected() const { return NumCollected; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/**
+	 * @brief Marks the placement of a collected artifact.
+	 */
+	void HandleArtifactCollected(AActor* Collectable, ASkaterCharacterBase* Collector);
+
+private:
+	struct FTrackedPlacement
+	{
+		TWeakObjectPtr<AArtifactPlacementCell> Cell;
+
+		FSoftObjectPath DataPath;
+
+		int32 PlacementIndex = INDEX_NONE;
+	};
+
+	// Collected bits per placement asset
+	TMap<FSoftObjectPath, TBitArray<>> CollectedPlacements;
+
+	// Materialised artifact -> its placement
+	TMap<TObjectKey<APointArtifact>, FTrackedPlacement> TrackedArtifacts;
+
+	int32 NumCollected = 0;
+
+	FDelegateHandle CollectedHandle;
+};
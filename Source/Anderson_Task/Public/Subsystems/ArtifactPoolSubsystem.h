@@ -0,0 +1,129 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "ArtifactPoolSubsystem.generated.h"
+
+class APointArtifact;
+class UArtifactData;
+
+/**
+ * @brief Free artifacts sharing one class.
+ */
+USTRUCT()
+struct FPooledArtifactList
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<APointArtifact>> Artifacts;
+};
+
+/**
+ * @brief World subsystem that recycles point artifacts instead of destroying them.
+ * @details Released artifacts are deactivated and hidden in place, then handed out again by
+ * AcquireArtifact with new data and transform. Only artifacts the pool spawned are recycled;
+ * level-placed ones are deactivated where they stand. Also drives timed respawns for artifact types
+ * with a RespawnDelay, so long sessions keep a flat actor count.
+ */
+UCLASS()
+class ANDERSON_TASK_API UArtifactPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Deinitialize() override;
+
+	/**
+	 * @brief Gets an active artifact, reusing a pooled one when available.
+	 *
+	 * @param ArtifactClass - The artifact class to acquire.
+	 * @param Data - The artifact data to assign.
+	 * @param Transform - World transform of the artifact.
+	 * @return The active artifact, or nullptr if spawning failed.
+	 */
+	APointArtifact* AcquireArtifact(TSubclassOf<APointArtifact> ArtifactClass, UArtifactData* Data,
+		const FTransform& Transform);
+
+	/**
+	 * @brief Deactivates an artifact and returns it to the pool.
+	 * @details Any pending respawn for the artifact is cancelled. Artifacts the pool did not spawn
+	 * are only deactivated in place.
+	 *
+	 * @param Artifact - The artifact to release.
+	 */
+	void ReleaseArtifact(APointArtifact* Artifact);
+
+	/**
+	 * @brief Reactivates an artifact in place after a delay.
+	 *
+	 * @param Artifact - The collected artifact.
+	 * @param Delay - Time in seconds before the artifact is reset.
+	 */
+	void ScheduleRespawn(APointArtifact* Artifact, float Delay);
+
+	/**
+	 * @brief Spawns inactive artifacts ahead of time.
+	 * @details The artifacts are spawned hidden and go straight to the pool without being activated.
+	 *
+	 * @param ArtifactClass - The artifact class to spawn.
+	 * @param Count - Number of pooled artifacts to add.
+	 */
+	void PrewarmPool(TSubclassOf<APointArtifact> ArtifactClass, int32 Count);
+
+	/**
+	 * @brief Gets the number of inactive artifacts waiting in the pool.
+	 * @return Total pooled artifacts across all classes.
+	 */
+	int32 GetNumPooled() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/**
+	 * @brief Spawns a new artifact owned by the pool.
+	 *
+	 * @param ArtifactClass - The artifact class to spawn.
+	 * @param Data - The artifact data to assign when spawned active.
+	 * @param Transform - World transform of the artifact.
+	 * @param bActive - Whether to activate the artifact or spawn it deactivated.
+	 * @return The spawned artifact, or nullptr if spawning failed.
+	 */
+	APointArtifact* SpawnArtifact(TSubclassOf<APointArtifact> ArtifactClass, UArtifactData* Data,
+		const FTransform& Transform, bool bActive);
+
+	/**
+	 * @brief Adds a deactivated artifact to the free list of its class, once.
+	 * @param Artifact - The artifact to pool.
+	 */
+	void AddToFreeList(APointArtifact* Artifact);
+
+	/**
+	 * @brief Timer callback that resets an artifact with its current data.
+	 * @param Artifact - The artifact to reactivate.
+	 */
+	void RespawnArtifact(TWeakObjectPtr<APointArtifact> Artifact);
+
+	/**
+	 * @brief Cancels a pending respawn, if any.
+	 * @param Artifact - The artifact whose respawn is cancelled.
+	 */
+	void CancelRespawn(const APointArtifact* Artifact);
+
+private:
+	// Inactive artifacts ready for reuse, keyed by class
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UClass>, FPooledArtifactList> FreeArtifacts;
+
+	// Artifacts currently in a free list, guards against double release
+	TSet<TObjectKey<APointArtifact>> PooledArtifacts;
+
+	// Artifacts spawned by the pool, the only ones it recycles
+	TSet<TObjectKey<APointArtifact>> OwnedArtifacts;
+
+	// Pending respawn timers keyed by artifact
+	TMap<TObjectKey<APointArtifact>, FTimerHandle> RespawnTimers;
+};
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ArtifactRegistrySubsystem.generated.h"
+
+class UArtifactData;
+class ASkaterCharacterBase;
+class AArtifactInstanceManager;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogArtifactRegistry, Log, All);
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnArtifactCollectedNative, AActor* /*Collectable*/,
+	ASkaterCharacterBase* /*Collector*/);
+
+/**
+ * @brief World subsystem that owns collection detection for every registered artifact.
+ * @details Artifacts register their position, radius and data once and carry no collision
+ * primitives. Data is stored in packed SoA arrays and bucketed into a uniform-grid spatial hash;
+ * once per frame every registered skater capsule is tested against the cells it touches and
+ * hits are routed through ICollectable::OnCollected.
+ */
+UCLASS(Config = Game)
+class ANDERSON_TASK_API UArtifactRegistrySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * @brief Registers a collectable actor with the registry.
+	 * @details The actor must implement ICollectable. Its current location is used as the
+	 * collection centre.
+	 *
+	 * @param Collectable - The actor to register.
+	 * @param Data - The artifact data describing the collectable.
+	 * @param Radius - Collection radius around the actor location.
+	 * @return A stable handle for the entry, or INDEX_NONE if registration failed.
+	 */
+	int32 RegisterArtifact(AActor* Collectable, UArtifactData* Data, float Radius);
+
+	/**
+	 * @brief Removes an entry from the registry.
+	 * @param Handle - The handle returned by RegisterArtifact. Invalid handles are ignored.
+	 */
+	void UnregisterArtifact(int32 Handle);
+
+	/**
+	 * @brief Registers a skater whose capsule is tested against artifacts each frame.
+	 * @param Collector - The skater to register.
+	 */
+	void RegisterCollector(ASkaterCharacterBase* Collector);
+
+	/**
+	 * @brief Stops testing the given skater against artifacts.
+	 * @param Collector - The skater to unregister.
+	 */
+	void UnregisterCollector(ASkaterCharacterBase* Collector);
+
+	/**
+	 * @brief Finds the registered artifact closest to a location.
+	 * @details Walks the spatial hash in rings of cells around the location, stopping once no
+	 * closer cell remains, within one cell layer above and below.
+	 *
+	 * @param Location - World location to search from.
+	 * @param SearchRadius - Maximum distance to an artifact.
+	 * @param OutLocation - Receives the artifact's collection centre, if found.
+	 * @return The closest artifact, or nullptr if none is within SearchRadius.
+	 */
+	AActor* FindNearestArtifact(const FVector& Location, float SearchRadius, FVector& OutLocation) const;
+
+	/**
+	 * @brief Gets the number of registered artifacts.
+	 * @return Number of live registry entries.
+	 */
+	FORCEINLINE int32 GetNumArtifacts() const { return Positions.Num(); }
+
+	/**
+	 * @brief Gets the number of registered collectors.
+	 * @return Number of registered skaters.
+	 */
+	FORCEINLINE int32 GetNumCollectors() const { return Collectors.Num(); }
+
+	/**
+	 * @brief Gets the actor that renders instanced artifacts in this world.
+	 * @details Spawned on first use. Each machine owns its own local instance.
+	 * @return The instance manager, or nullptr if it could not be spawned.
+	 */
+	AArtifactInstanceManager* GetInstanceManager();
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/**
+	 * @brief Converts a world location into its spatial hash cell.
+	 * @param Location - World location.
+	 * @return The cell coordinates containing the location.
+	 */
+	FIntVector GetCellKey(const FVector& Location) const;
+
+	/**
+	 * @brief Gathers the handles of every artifact overlapping the given capsule.
+	 *
+	 * @param Collector - The skater whose capsule is tested.
+	 * @param OutHandles - Receives the overlapping handles.
+	 */
+	void GatherOverlaps(const ASkaterCharacterBase* Collector, TArray<int32>& OutHandles) const;
+
+	/**
+	 * @brief Requests the feedback bundle of artifact types near any collector.
+	 * @details Feedback assets are streamed on first proximity rather than with the map.
+	 */
+	void RequestNearbyFeedback();
+
+public:
+	// Edge length of one spatial hash cell in world units
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Registry", meta = (ClampMin = "1.0"))
+	float CellSize = 400.f;
+
+	// Horizontal distance at which a skater triggers feedback streaming for nearby artifacts
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Registry|Streaming", meta = (ClampMin = "0.0"))
+	float FeedbackPreloadDistance = 2000.f;
+
+	// Seconds between feedback proximity checks
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Registry|Streaming", meta = (ClampMin = "0.0"))
+	float ProximityCheckInterval = 0.5f;
+
+	// Broadcast on the authority after an artifact accepted a collection
+	FOnArtifactCollectedNative OnArtifactCollected;
+
+private:
+	// Packed per-artifact data (dense, indexed by DenseIndex) -------
+	TArray<FVector> Positions;
+
+	TArray<float> Radii;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UArtifactData>> ArtifactDatas;
+
+	TArray<TWeakObjectPtr<AActor>> Collectables;
+
+	TArray<FIntVector> CellKeys;
+
+	// Dense index -> handle
+	TArray<int32> DenseToHandle;
+
+	// Handle bookkeeping --------------------------------------------
+	// Handle -> dense index, INDEX_NONE for free handles
+	TArray<int32> HandleToDense;
+
+	TArray<int32> FreeHandles;
+
+	// Spatial hash: cell -> handles inside the cell
+	TMap<FIntVector, TArray<int32>> Cells;
+
+	// Largest radius ever registered, used to pad cell queries
+	float MaxRadius = 0.f;
+
+	// Time accumulated towards the next proximity check
+	float ProximityCheckAccumulator = 0.f;
+
+	// Skaters tested against the registry every frame
+	TArray<TWeakObjectPtr<ASkaterCharacterBase>> Collectors;
+
+	// Lazily spawned renderer for instanced artifacts
+	UPROPERTY(Transient)
+	TObjectPtr<AArtifactInstanceManager> InstanceManager;
+};
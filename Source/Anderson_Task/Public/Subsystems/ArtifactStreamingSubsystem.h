@@ -0,0 +1,76 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/StreamableManager.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "ArtifactStreamingSubsystem.generated.h"
+
+class UArtifactData;
+
+/**
+ * @brief World subsystem that streams artifact assets through the AssetManager.
+ * @details The "Visual" bundle of every artifact type referenced by the world is preloaded
+ * asynchronously when play begins. The "Feedback" bundle is only requested once a skater gets close to an artifact of
+ * that type, keeping audio and VFX out of memory until they can actually be played.
+ */
+UCLASS()
+class ANDERSON_TASK_API UArtifactStreamingSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// UWorldSubsystem interface
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * @brief Loads the visual bundle of an artifact type.
+	 * @details The delegate runs once the bundle is resident, immediately if it already is.
+	 *
+	 * @param Data - The artifact data to load visuals for.
+	 * @param OnLoaded - Called when the mesh and material are available.
+	 */
+	void RequestVisuals(const UArtifactData* Data, FStreamableDelegate OnLoaded);
+
+	/**
+	 * @brief Loads the feedback bundle of an artifact type.
+	 * @details Subsequent requests for the same type are ignored. Pooled feedback components
+	 * are pre-warmed once the bundle arrives.
+	 *
+	 * @param Data - The artifact data to load feedback assets for.
+	 */
+	void RequestFeedback(const UArtifactData* Data);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/**
+	 * @brief Loads a bundle of an artifact type through the AssetManager.
+	 * @details Artifact data the AssetManager does not track has its bundle assets streamed
+	 * directly instead. The delegate runs immediately if there is nothing left to load.
+	 *
+	 * @param Data - The artifact data to load the bundle for.
+	 * @param Bundle - VisualBundle or FeedbackBundle.
+	 * @param OnLoaded - Called when the bundle is resident.
+	 * @return The load handle, or nullptr if nothing had to be loaded.
+	 */
+	TSharedPtr<FStreamableHandle> LoadBundle(const UArtifactData* Data, FName Bundle, FStreamableDelegate OnLoaded);
+
+	/**
+	 * @brief Called when a feedback bundle finished loading.
+	 * @param Data - The artifact data whose feedback assets arrived.
+	 */
+	void OnFeedbackLoaded(TWeakObjectPtr<const UArtifactData> Data);
+
+private:
+	// Keeps the preloaded visual bundles resident
+	TArray<TSharedPtr<FStreamableHandle>> VisualPreloadHandles;
+
+	// Bundle handles for visuals requested on demand
+	TArray<TSharedPtr<FStreamableHandle>> VisualHandles;
+
+	// Feedback bundles requested so far
+	TMap<TObjectKey<UArtifactData>, TSharedPtr<FStreamableHandle>> FeedbackHandles;
+};
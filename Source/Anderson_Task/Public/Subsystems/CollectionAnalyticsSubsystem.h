@@ -0,0 +1,131 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Analytics/CollectionAnalyticsWorker.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CollectionAnalyticsSubsystem.generated.h"
+
+class ASkaterCharacterBase;
+class UArtifactData;
+
+/**
+ * @brief World subsystem feeding collections, placements and skater positions to the background
+ * analytics worker.
+ * @details The game thread only packs small records and pushes them into the worker's lock-free
+ * queues; aggregation and disk writes run on the worker thread. Logs roll in
+ * Saved/Analytics/<Map>_<Timestamp>_<Index>.bin and are turned into heatmaps offline by the
+ * SkaterHeatmap commandlet. Only the authority records.
+ */
+UCLASS(Config = Game)
+class ANDERSON_TASK_API UCollectionAnalyticsSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Deinitialize() override;
+
+	// UWorldSubsystem interface
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * @brief Starts sampling a skater's position every SampleInterval.
+	 * @param Skater - The skater to sample.
+	 */
+	void RegisterSkater(ASkaterCharacterBase* Skater);
+
+	/**
+	 * @brief Stops sampling a skater.
+	 * @param Skater - The skater to stop sampling.
+	 */
+	void UnregisterSkater(ASkaterCharacterBase* Skater);
+
+	/**
+	 * @brief Records one collection.
+	 *
+	 * @param Collector - The collecting actor.
+	 * @param Data - The collected artifact's data.
+	 * @param Location - Where the artifact was collected.
+	 * @param Points - Points awarded.
+	 */
+	void RecordCollection(const AActor* Collector, const UArtifactData* Data, const FVector& Location, int32 Points);
+
+	/**
+	 * @brief Records an artifact becoming collectable.
+	 * @details Each placement is recorded once. Respawns, pool reuse and re-streamed levels that
+	 * register the same artifact type at the same location again are ignored.
+	 *
+	 * @param Data - The artifact's data.
+	 * @param Location - Where the artifact was placed.
+	 */
+	void RecordPlacement(const UArtifactData* Data, const FVector& Location);
+
+	/**
+	 * @brief Copies the aggregates built so far by the worker.
+	 * @param OutSnapshot - Receives the aggregates; empty if analytics is disabled.
+	 */
+	void GetSnapshot(FCollectionAnalyticsSnapshot& OutSnapshot) const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/**
+	 * @brief Gets the stable ID of an artifact data asset, caching it.
+	 */
+	uint32 GetArtifactDataId(const UArtifactData* Data);
+
+	/**
+	 * @brief Gets the analytics ID of a pawn from its player state.
+	 */
+	static uint32 GetPlayerId(const AActor* Actor);
+
+	/**
+	 * @brief Queues the position of every registered skater.
+	 */
+	void SampleSkaters();
+
+public:
+	// Whether collections are recorded
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Analytics")
+	bool bEnableAnalytics = true;
+
+	// Heatmap cell size in world units
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Analytics", meta = (ClampMin = "1.0"))
+	float CellSize = 1000.f;
+
+	// Size in MB at which the log rolls to a new file
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Analytics", meta = (ClampMin = "1"))
+	int32 MaxLogFileMB = 16;
+
+	// Seconds between skater position samples
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Analytics", meta = (ClampMin = "0.05"))
+	float SampleInterval = 0.5f;
+
+	// Log files kept per session
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Analytics", meta = (ClampMin = "1"))
+	int32 MaxLogFiles = 8;
+
+	// Milliseconds between worker drains
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Analytics", meta = (ClampMin = "1"))
+	int32 DrainIntervalMs = 250;
+
+private:
+	TUniquePtr<FCollectionAnalyticsWorker> Worker;
+
+	// Artifact data -> stable ID, game thread only
+	TMap<TObjectKey<UArtifactData>, uint32> ArtifactDataIds;
+
+	// Placements recorded so far as artifact data ID and location rounded to centimetres
+	TSet<TPair<uint32, FIntVector>> RecordedPlacements;
+
+	// Skaters whose positions are sampled
+	TArray<TWeakObjectPtr<ASkaterCharacterBase>> Skaters;
+
+	float SampleAccumulator = 0.f;
+};
@@ -0,0 +1,228 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "FeedbackPoolSubsystem.generated.h"
+
+class UArtifactData;
+class UAudioComponent;
+class UFXSystemAsset;
+class UFXSystemComponent;
+class USoundBase;
+
+/**
+ * @brief Handle to feedback started through the feedback pool.
+ * @details Pooled components outlive the feedback they were handed out for, so the handle also
+ * keeps the serial each component was issued with. A handle whose serial no longer matches refers
+ * to feedback that already ended and is ignored.
+ */
+struct FCollectionFeedbackHandle
+{
+	TWeakObjectPtr<UAudioComponent> Audio;
+
+	TWeakObjectPtr<UFXSystemComponent> Effect;
+
+	uint32 AudioSerial = 0;
+
+	uint32 EffectSerial = 0;
+};
+
+/**
+ * @brief Playing feedback component tracked against the concurrency caps.
+ */
+struct FActiveFeedback
+{
+	TWeakObjectPtr<USceneComponent> Component;
+
+	int32 Priority = 0;
+
+	// Serial the component was issued with for this feedback
+	uint32 Serial = 0;
+};
+
+/**
+ * @brief Counters describing how well the feedback pool is serving requests.
+ */
+struct FFeedbackPoolStats
+{
+	// Requests served by a reused component
+	int32 Hits = 0;
+
+	// Requests that had to create a new component
+	int32 Misses = 0;
+
+	// Requests dropped by distance or concurrency limits
+	int32 Culled = 0;
+};
+
+/**
+ * @brief Free audio components sharing one sound.
+ */
+USTRUCT()
+struct FFeedbackAudioList
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UAudioComponent>> Components;
+};
+
+/**
+ * @brief World-level pool for collection audio and VFX.
+ * @details Audio components are kept per sound and recycled when playback finishes. Niagara and
+ * Cascade effects use the engine's component pools (AutoRelease), primed per artifact type.
+ * Concurrent instances are capped; lower priority feedback is stolen or culled, and feedback
+ * farther than CullDistance from every local view is skipped.
+ */
+UCLASS(Config = Game)
+class ANDERSON_TASK_API UFeedbackPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Deinitialize() override;
+
+	/**
+	 * @brief Creates pooled components for an artifact type ahead of time.
+	 * @details Runs once per artifact data; later calls are ignored.
+	 *
+	 * @param Data - The artifact data whose feedback assets are pre-warmed.
+	 */
+	void PrewarmFeedback(const UArtifactData* Data);
+
+	/**
+	 * @brief Plays the collection feedback of an artifact at a location.
+	 *
+	 * @param Data - The artifact data containing feedback properties.
+	 * @param Transform - World transform to play the feedback at.
+	 * @return Handle to the started feedback; members are null when culled.
+	 */
+	FCollectionFeedbackHandle PlayFeedback(const UArtifactData* Data, const FTransform& Transform);
+
+	/**
+	 * @brief Stops feedback and returns its components to their pools.
+	 * @param Handle - The feedback to stop. Reset on return.
+	 */
+	void StopFeedback(FCollectionFeedbackHandle& Handle);
+
+	/**
+	 * @brief Gets the pool counters.
+	 * @return Hit, miss and cull counters since the world started.
+	 */
+	FORCEINLINE const FFeedbackPoolStats& GetStats() const { return Stats; }
+
+	/**
+	 * @brief Gets the number of feedback components currently playing.
+	 * @return Live audio plus live effect components.
+	 */
+	int32 GetNumLiveComponents() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/**
+	 * @brief Checks whether any local view is close enough to see or hear the feedback.
+	 * @param Location - World location of the feedback.
+	 * @return true if the feedback should play.
+	 */
+	bool IsWithinCullDistance(const FVector& Location) const;
+
+	/**
+	 * @brief Checks for room for new feedback under the concurrency cap.
+	 * @details Drops finished and reissued entries first. When the cap is reached, picks the lowest
+	 * priority entry if it ranks below the new request; it is only stopped by EvictSlot once the new
+	 * feedback actually got a component.
+	 *
+	 * @param Active - Active entries of one feedback kind.
+	 * @param MaxConcurrent - Cap for that kind.
+	 * @param Priority - Priority of the new request.
+	 * @param OutEvictIndex - Receives the entry to evict, INDEX_NONE if there is a free slot.
+	 * @return true if the new request may play.
+	 */
+	bool ReserveSlot(TArray<FActiveFeedback>& Active, int32 MaxConcurrent, int32 Priority, int32& OutEvictIndex);
+
+	/**
+	 * @brief Stops and removes the entry picked by ReserveSlot.
+	 *
+	 * @param Active - Active entries of one feedback kind.
+	 * @param Index - Entry to evict; INDEX_NONE does nothing.
+	 */
+	void EvictSlot(TArray<FActiveFeedback>& Active, int32 Index);
+
+	/**
+	 * @brief Issues a new serial to a component handed out for feedback.
+	 * @return The serial, never 0.
+	 */
+	uint32 IssueSerial(const USceneComponent* Component);
+
+	/**
+	 * @brief Checks that a component is still serving the feedback it was issued for.
+	 * @return true if Serial is the component's current serial.
+	 */
+	bool IsCurrentSerial(const USceneComponent* Component, uint32 Serial) const;
+
+	/**
+	 * @brief Gets a stopped audio component for the sound, creating one if the pool is empty.
+	 */
+	UAudioComponent* AcquireAudio(USoundBase* Sound);
+
+	/**
+	 * @brief Returns an audio component to its sound's free list.
+	 */
+	void HandleAudioFinished(UAudioComponent* AudioComponent);
+
+	/**
+	 * @brief Spawns an effect component through the engine component pool.
+	 * @details Pre-warm spawns use manual release so they can be handed back straight away;
+	 * gameplay spawns auto-release when the effect completes.
+	 *
+	 * @param Effect - Niagara system or Cascade particle system.
+	 * @param Transform - World transform of the effect.
+	 * @param bForPrewarm - true to spawn inactive for pre-warming.
+	 * @return The pooled component, or nullptr for unsupported assets.
+	 */
+	UFXSystemComponent* SpawnEffect(UFXSystemAsset* Effect, const FTransform& Transform, bool bForPrewarm);
+
+public:
+	// Maximum collection sounds playing at once
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Feedback", meta = (ClampMin = "1"))
+	int32 MaxConcurrentAudio = 16;
+
+	// Maximum collection effects playing at once
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Feedback", meta = (ClampMin = "1"))
+	int32 MaxConcurrentEffects = 24;
+
+	// Feedback farther than this from every local view is skipped
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Feedback", meta = (ClampMin = "0.0"))
+	float CullDistance = 6000.f;
+
+private:
+	// Every audio component created by the pool, keeps playing components referenced
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UAudioComponent>> AllAudio;
+
+	// Free audio components keyed by sound
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<USoundBase>, FFeedbackAudioList> FreeAudio;
+
+	// Playing feedback with its priority
+	TArray<FActiveFeedback> ActiveAudio;
+
+	TArray<FActiveFeedback> ActiveEffects;
+
+	// Current serial of every component handed out, removed when the component is released
+	TMap<TObjectKey<USceneComponent>, uint32> ComponentSerials;
+
+	uint32 LastSerial = 0;
+
+	// Effect components already handed out by the engine pools, used to detect reuse
+	TSet<TObjectKey<UFXSystemComponent>> KnownEffectComponents;
+
+	// Artifact types that have been pre-warmed
+	TSet<TObjectKey<UArtifactData>> PrewarmedData;
+
+	FFeedbackPoolStats Stats;
+};
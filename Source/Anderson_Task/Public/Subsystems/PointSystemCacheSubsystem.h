@@ -0,0 +1,103 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PointSystemCacheSubsystem.generated.h"
+
+class IPointSystem;
+class ASkaterPlayerState;
+
+/**
+ * @brief A point system resolved for a collector.
+ * @details Valid for the current frame only; do not store.
+ */
+struct FResolvedPointSystem
+{
+	// Object implementing IPointSystem
+	UObject* Object = nullptr;
+
+	// Set when AddPoints can be called natively, skipping reflective dispatch
+	ASkaterPlayerState* NativeState = nullptr;
+
+	FORCEINLINE bool IsValid() const { return Object != nullptr; }
+
+	/**
+	 * @brief Adds points through the fastest available path.
+	 * 
+	 * @param Points - Number of points to add (can be negative).
+	 * @param SourceId - What awarded the points; recorded by native point systems only.
+	 * @return The new total points.
+	 */
+	int32 AddPoints(int32 Points, FName SourceId = NAME_None) const;
+};
+
+/**
+ * @brief World subsystem caching which IPointSystem each collector scores into.
+ * @details APointArtifact::FindPointSystemInActor walks casts, a reflective component scan and
+ * the PlayerState on every call. Resolutions are cached per collector and dropped when the
+ * collector's controller or PlayerState changes, so burst pickups resolve with one map lookup.
+ */
+UCLASS()
+class ANDERSON_TASK_API UPointSystemCacheSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Deinitialize() override;
+
+	/**
+	 * @brief Gets the point system of a collector, resolving and caching it on first use.
+	 * @details Failed resolutions are not cached; a pawn may receive its PlayerState later.
+	 *
+	 * @param Collector - The actor to resolve.
+	 * @return The resolved point system, invalid if the actor has none.
+	 */
+	FResolvedPointSystem Resolve(AActor* Collector);
+
+	/**
+	 * @brief Drops the cached resolution of a collector.
+	 * @details Called on possession and PlayerState changes.
+	 *
+	 * @param Collector - The actor whose resolution is stale.
+	 */
+	void Invalidate(const AActor* Collector);
+
+	/**
+	 * @brief Gets the number of cached resolutions.
+	 * @return Number of cache entries, stale ones included.
+	 */
+	FORCEINLINE int32 GetNumCached() const { return Cache.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/**
+	 * @brief Checks if a class implements AddPoints natively.
+	 * @details Blueprint overrides must keep going through Execute_AddPoints.
+	 *
+	 * @param Class - The class implementing IPointSystem.
+	 * @return true if AddPoints_Implementation can be called directly.
+	 */
+	static bool HasNativeAddPoints(const UClass* Class);
+
+	/**
+	 * @brief Removes entries whose collector or point system was destroyed.
+	 */
+	void PruneStaleEntries();
+
+private:
+	struct FCacheEntry
+	{
+		TWeakObjectPtr<UObject> Object;
+
+		bool bNativeAddPoints = false;
+	};
+
+	// Collector -> resolved point system
+	TMap<TWeakObjectPtr<const AActor>, FCacheEntry> Cache;
+
+	// Cache size at which stale entries are pruned next
+	int32 NextPruneSize = 64;
+};
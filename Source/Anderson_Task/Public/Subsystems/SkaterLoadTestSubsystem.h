@@ -0,0 +1,197 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SkaterInputRecorderComponent.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SkaterLoadTestSubsystem.generated.h"
+
+class APointArtifact;
+class ASkaterCharacterBase;
+class UArtifactData;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSkaterLoadTest, Log, All);
+
+/**
+ * @brief World subsystem driving headless load tests of skater servers.
+ * @details Only created when the process runs with -SkaterLoadTest. On the server it spawns a
+ * configurable density of point artifacts and optionally a crowd of AI skaters, and samples
+ * frame time, per-connection bandwidth and
+ * collections per second into a CSV report. On clients it drives the local skater through
+ * SetMovementInput from a scripted pattern, or replays an input recording through the skater's
+ * USkaterInputRecorderComponent, so any number of -nullrhi clients can be pointed at one
+ * dedicated server.
+ *
+ * Command line overrides:
+ *  -LoadTestDensity=N      Artifacts per 10m x 10m area.
+ *  -LoadTestExtent=N       Half size of the square spawn area in world units.
+ *  -LoadTestBots=N         AI skaters spawned on the server.
+ *  -LoadTestDuration=N     Seconds before the report is written and the process exits.
+ *  -LoadTestInput=Path     Input recording (-SkaterRecordInput output) replayed in a loop.
+ *  -LoadTestSeed=N         Seed for artifact placement and scripted input.
+ *  -LoadTestReport=Path    Output CSV path.
+ */
+UCLASS(Config = Game)
+class ANDERSON_TASK_API USkaterLoadTestSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// UWorldSubsystem interface
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * @brief Checks if the process was started in load-test mode.
+	 * @return true if -SkaterLoadTest is on the command line.
+	 */
+	static bool IsLoadTestEnabled();
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/**
+	 * @brief Spawns the configured artifact density around SpawnOrigin through the artifact pool.
+	 */
+	void SpawnArtifacts();
+
+	/**
+	 * @brief Spawns BotCount AI skaters spread over the spawn area.
+	 */
+	void SpawnBots();
+
+	/**
+	 * @brief Projects a point of the spawn area onto the ground.
+	 *
+	 * @param Stream - Random stream picking the point.
+	 * @param OutLocation - Receives the ground location.
+	 */
+	void PickGroundLocation(const FRandomStream& Stream, FVector& OutLocation) const;
+
+	/**
+	 * @brief Feeds scripted input into, or starts the recording replaying on, every locally
+	 * controlled skater.
+	 */
+	void DriveLocalSkaters();
+
+	/**
+	 * @brief Gets the scripted input for the given time.
+	 * @details Weaves left and right with periodic braking; phase and frequency come from the seed
+	 * so clients spread out instead of moving in lockstep.
+	 *
+	 * @param Time - Seconds since the load test started.
+	 * @return The scripted input.
+	 */
+	FVector2D SampleScriptedInput(float Time) const;
+
+	/**
+	 * @brief Appends one report row with the statistics accumulated since the last row.
+	 */
+	void FlushSample();
+
+	/**
+	 * @brief Writes the CSV report to disk once.
+	 */
+	void WriteReport();
+
+	/**
+	 * @brief Counts a collection towards the current sample.
+	 *
+	 * @param Collectable - The collected artifact.
+	 * @param Collector - The skater that collected it.
+	 */
+	void HandleArtifactCollected(AActor* Collectable, ASkaterCharacterBase* Collector);
+
+public:
+	// Artifact class spawned on the server
+	UPROPERTY(Config, EditDefaultsOnly, Category = "LoadTest")
+	TSoftClassPtr<APointArtifact> ArtifactClass;
+
+	// Skater class spawned as bots; possessed by its AI controller class
+	UPROPERTY(Config, EditDefaultsOnly, Category = "LoadTest")
+	TSoftClassPtr<ASkaterCharacterBase> BotClass;
+
+	// AI skaters spawned on the server
+	UPROPERTY(Config, EditDefaultsOnly, Category = "LoadTest", meta = (ClampMin = "0"))
+	int32 BotCount = 0;
+
+	// Data assigned to spawned artifacts; falls back to the class default's data
+	UPROPERTY(Config, EditDefaultsOnly, Category = "LoadTest")
+	TSoftObjectPtr<UArtifactData> ArtifactData;
+
+	// Artifacts per 10m x 10m area
+	UPROPERTY(Config, EditDefaultsOnly, Category = "LoadTest", meta = (ClampMin = "0.0"))
+	float ArtifactDensity = 2.5f;
+
+	// Centre of the square spawn area
+	UPROPERTY(Config, EditDefaultsOnly, Category = "LoadTest")
+	FVector SpawnOrigin = FVector::ZeroVector;
+
+	// Half size of the square spawn area in world units
+	UPROPERTY(Config, EditDefaultsOnly, Category = "LoadTest", meta = (ClampMin = "0.0"))
+	float SpawnExtent = 10000.f;
+
+	// Height above the ground at which artifacts are placed
+	UPROPERTY(Config, EditDefaultsOnly, Category = "LoadTest")
+	float SpawnHeightOffset = 100.f;
+
+	// Seconds covered by one report row
+	UPROPERTY(Config, EditDefaultsOnly, Category = "LoadTest", meta = (ClampMin = "0.1"))
+	float SampleInterval = 1.f;
+
+	// Seconds before the report is written and the process exits, 0 to run until shutdown
+	UPROPERTY(Config, EditDefaultsOnly, Category = "LoadTest", meta = (ClampMin = "0.0"))
+	float Duration = 0.f;
+
+private:
+	// Input recording replayed by local skaters, empty for scripted input
+	FSkaterInputRecording RecordedInput;
+
+	// Report rows, header included
+	TArray<FString> ReportRows;
+
+	// Output CSV path
+	FString ReportPath;
+
+	// Seed for placement and scripted input
+	int32 Seed = 0;
+
+	// Scripted input shape derived from the seed
+	float ScriptFrequency = 0.1f;
+
+	float ScriptPhase = 0.f;
+
+	// Seconds since play began
+	float ElapsedTime = 0.f;
+
+	// Statistics accumulated for the current row ---------------------
+	float SampleAccumulator = 0.f;
+
+	double SampleFrameTime = 0.0;
+
+	double SampleWorkTime = 0.0;
+
+	float SampleMaxWorkTime = 0.f;
+
+	int32 SampleFrames = 0;
+
+	int32 SampleCollections = 0;
+
+	// Collection events across the whole run
+	int32 TotalCollections = 0;
+
+	FDelegateHandle CollectedHandle;
+
+	bool bHasBegunPlay = false;
+
+	bool bReportWritten = false;
+};
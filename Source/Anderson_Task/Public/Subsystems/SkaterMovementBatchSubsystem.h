@@ -0,0 +1,103 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Characters/SkaterCharacterBase.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SkaterMovementBatchSubsystem.generated.h"
+
+class USkaterMovementComponent;
+
+/**
+ * @brief World subsystem updating the steering of many skaters in one parallel pass.
+ * @details Batched skaters stop ticking and their movement components stop steering on their own.
+ * Input, turn value and movement state live in packed arrays; once per frame steering is solved
+ * for all of them in a ParallelFor, then results are written back to the movement components on
+ * the game thread. Intended for AI and replay crowds: only locally controlled skaters can be
+ * batched, as owning-client prediction needs steering inside the saved moves.
+ */
+UCLASS(Config = Game)
+class ANDERSON_TASK_API USkaterMovementBatchSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * @brief Moves a skater's steering into the batch.
+	 * @details Disables the skater's actor tick and hands its steering to the batch. Steering
+	 * tuning is captured now; re-register to pick up changes.
+	 *
+	 * @param Skater - The skater to batch.
+	 * @return A stable handle, or INDEX_NONE if the skater has no USkaterMovementComponent.
+	 */
+	int32 RegisterSkater(ASkaterCharacterBase* Skater);
+
+	/**
+	 * @brief Returns a skater to per-actor updates.
+	 * @param Handle - The handle returned by RegisterSkater. Invalid handles are ignored.
+	 */
+	void UnregisterSkater(int32 Handle);
+
+	/**
+	 * @brief Sets the movement input of a batched skater.
+	 *
+	 * @param Handle - The skater's handle.
+	 * @param Input - X for steering, Y for acceleration/braking.
+	 */
+	void SetInput(int32 Handle, const FVector2D& Input);
+
+	/**
+	 * @brief Solves steering for every batched skater and applies the results.
+	 * @param DeltaTime - Time step.
+	 */
+	void UpdateSkaters(float DeltaTime);
+
+	/**
+	 * @brief Gets the number of batched skaters.
+	 * @return Number of live batch entries.
+	 */
+	FORCEINLINE int32 GetNumSkaters() const { return Inputs.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+	// Minimum skaters per worker task
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Batching", meta = (ClampMin = "1"))
+	int32 MinBatchSize = 64;
+
+private:
+	// Packed per-skater data (dense, indexed by DenseIndex) ---------
+	TArray<FVector2D> Inputs;
+
+	TArray<float> TurnValues;
+
+	TArray<float> TurnRates;
+
+	TArray<float> SteeringInterpSpeeds;
+
+	// Output of the parallel pass, consumed by the write-back
+	TArray<float> YawDeltas;
+
+	TArray<ESkaterMovementState> States;
+
+	TArray<TWeakObjectPtr<ASkaterCharacterBase>> Skaters;
+
+	TArray<TWeakObjectPtr<USkaterMovementComponent>> MovementComponents;
+
+	// Dense index -> handle
+	TArray<int32> DenseToHandle;
+
+	// Handle bookkeeping --------------------------------------------
+	// Handle -> dense index, INDEX_NONE for free handles
+	TArray<int32> HandleToDense;
+
+	TArray<int32> FreeHandles;
+};
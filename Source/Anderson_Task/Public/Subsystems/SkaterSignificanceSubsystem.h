@@ -0,0 +1,157 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SkaterSignificanceSubsystem.generated.h"
+
+class ASkaterCharacterBase;
+
+/**
+ * Significance buckets of a skater, from invisible and far away to close and on screen.
+ */
+UENUM()
+enum class ESkaterSignificance : uint8
+{
+	Off,
+	Low,
+	Medium,
+	High
+};
+
+/**
+ * @brief Per-bucket cost settings applied to a skater.
+ */
+USTRUCT()
+struct FSkaterSignificanceSettings
+{
+	GENERATED_BODY()
+
+	// Tick interval of the skater actor, 0 for every frame
+	UPROPERTY(EditDefaultsOnly, Category = "Significance", meta = (ClampMin = "0.0"))
+	float ActorTickInterval = 0.f;
+
+	// Tick interval of the skeletal mesh, scaling how often animation updates
+	UPROPERTY(EditDefaultsOnly, Category = "Significance", meta = (ClampMin = "0.0"))
+	float MeshTickInterval = 0.f;
+
+	// Whether the character and skateboard meshes cast shadows
+	UPROPERTY(EditDefaultsOnly, Category = "Significance")
+	bool bCastShadows = true;
+
+	// Smoothing of simulated proxies between network updates
+	UPROPERTY(EditDefaultsOnly, Category = "Significance")
+	ENetworkSmoothingMode SmoothingMode = ENetworkSmoothingMode::Exponential;
+};
+
+/**
+ * @brief World subsystem scoring skaters by distance and visibility and throttling their cost.
+ * @details Skaters are registered with the engine significance manager, which is updated from the
+ * views of all local players. Each bucket maps to a tick interval for the actor and its skeletal
+ * mesh, shadow casting and proxy smoothing. Locally controlled skaters always stay High. Not used
+ * on dedicated servers, which have no views and must simulate every skater.
+ */
+UCLASS(Config = Game)
+class ANDERSON_TASK_API USkaterSignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	USkaterSignificanceSubsystem();
+
+	// USubsystem interface
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * @brief Starts scoring a skater.
+	 * @param Skater - The skater to register.
+	 */
+	void RegisterSkater(ASkaterCharacterBase* Skater);
+
+	/**
+	 * @brief Stops scoring a skater and restores its full cost settings.
+	 * @param Skater - The skater to unregister.
+	 */
+	void UnregisterSkater(ASkaterCharacterBase* Skater);
+
+	/**
+	 * @brief Gets the bucket last applied to a skater.
+	 * @param Skater - The skater to query.
+	 * @return The applied bucket, High if the skater is not registered.
+	 */
+	ESkaterSignificance GetSignificance(const ASkaterCharacterBase* Skater) const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/**
+	 * @brief Scores a skater from one viewpoint. May run on worker threads.
+	 *
+	 * @param Skater - The skater to score.
+	 * @param Viewpoint - Transform of a local player view.
+	 * @return The bucket as a float; the manager keeps the highest over all viewpoints.
+	 */
+	float CalculateSignificance(const ASkaterCharacterBase* Skater, const FTransform& Viewpoint) const;
+
+	/**
+	 * @brief Applies the settings of a bucket when it differs from the applied one.
+	 *
+	 * @param Skater - The skater to update.
+	 * @param Significance - The new bucket.
+	 */
+	void ApplySignificance(ASkaterCharacterBase* Skater, ESkaterSignificance Significance);
+
+	/**
+	 * @brief Gets the settings of a bucket.
+	 */
+	const FSkaterSignificanceSettings& GetSettings(ESkaterSignificance Significance) const;
+
+public:
+	// Distance under which an on-screen skater is High
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Significance", meta = (ClampMin = "0.0"))
+	float HighDistance = 2000.f;
+
+	// Distance under which an on-screen skater is Medium
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Significance", meta = (ClampMin = "0.0"))
+	float MediumDistance = 6000.f;
+
+	// Distance under which an on-screen skater is Low; beyond it skaters are Off
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Significance", meta = (ClampMin = "0.0"))
+	float LowDistance = 15000.f;
+
+	// Seconds since last render within which a skater counts as on screen
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Significance", meta = (ClampMin = "0.0"))
+	float RecentlyRenderedTolerance = 0.2f;
+
+	// Seconds between significance updates
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Significance", meta = (ClampMin = "0.0"))
+	float UpdateInterval = 0.1f;
+
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Significance|Buckets")
+	FSkaterSignificanceSettings HighSettings;
+
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Significance|Buckets")
+	FSkaterSignificanceSettings MediumSettings;
+
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Significance|Buckets")
+	FSkaterSignificanceSettings LowSettings;
+
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Significance|Buckets")
+	FSkaterSignificanceSettings OffSettings;
+
+private:
+	// Registered skaters and the bucket last applied to them
+	TMap<TWeakObjectPtr<ASkaterCharacterBase>, ESkaterSignificance> AppliedSignificance;
+
+	// Local player views, reused between updates
+	TArray<FTransform> Viewpoints;
+
+	// Time accumulated towards the next update
+	float UpdateAccumulator = 0.f;
+};
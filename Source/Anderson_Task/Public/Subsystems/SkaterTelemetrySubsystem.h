@@ -0,0 +1,179 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SkaterTelemetrySubsystem.generated.h"
+
+class ASkaterCharacterBase;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSkaterTelemetry, Log, All);
+
+/**
+ * Per-frame gameplay counters.
+ */
+struct FSkaterTelemetryFrame
+{
+	int32 ActiveSkaters = 0;
+
+	int32 ArtifactsAlive = 0;
+
+	int32 Collections = 0;
+
+	int32 FeedbackLive = 0;
+
+	int32 PointsBroadcasts = 0;
+};
+
+/**
+ * @brief World subsystem recording per-session performance telemetry.
+ * @details Every frame the gameplay counters are written to the Skater CSV profiler categories.
+ * While a session runs, started and ended by the game mode, the same counters are averaged over
+ * SampleInterval and streamed as CSV rows to a local telemetry file, and a JSON summary is written
+ * when the session ends. The file sink does not depend on the CSV profiler, so headless servers
+ * and load tests produce the same reports in any build configuration.
+ *
+ * Output goes to Saved/Telemetry/<Session>.csv and <Session>_Summary.json.
+ * -SkaterCsvCapture also runs a CSV profiler capture for the length of the session.
+ */
+UCLASS(Config = Game)
+class ANDERSON_TASK_API USkaterTelemetrySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Deinitialize() override;
+
+	// UWorldSubsystem interface
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * @brief Starts a telemetry session.
+	 * @details Opens the telemetry file and, if enabled, begins a CSV profiler capture. Ignored
+	 * while a session is running.
+	 *
+	 * @param InSessionName - Base name of the output files.
+	 */
+	void BeginSession(const FString& InSessionName);
+
+	/**
+	 * @brief Ends the running session and writes its summary.
+	 */
+	void EndSession();
+
+	/**
+	 * @brief Counts an OnPointsChanged broadcast towards the current frame.
+	 */
+	FORCEINLINE void RecordPointsBroadcast() { ++CurrentFrame.PointsBroadcasts; }
+
+	/**
+	 * @brief Checks if a session is running.
+	 * @return true between BeginSession and EndSession.
+	 */
+	FORCEINLINE bool IsSessionActive() const { return bSessionActive; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/**
+	 * @brief Reads the live counters into the current frame.
+	 */
+	void GatherFrame();
+
+	/**
+	 * @brief Adds the current frame to the session statistics.
+	 * @param FrameTime - Real frame time in seconds.
+	 */
+	void AccumulateFrame(float FrameTime);
+
+	/**
+	 * @brief Writes one telemetry row with the averages since the last row.
+	 */
+	void FlushSample();
+
+	/**
+	 * @brief Writes the session summary JSON.
+	 */
+	void WriteSummary() const;
+
+	/**
+	 * @brief Counts a collection towards the current frame.
+	 */
+	void HandleArtifactCollected(AActor* Collectable, ASkaterCharacterBase* Collector);
+
+public:
+	// Seconds covered by one telemetry row
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Telemetry", meta = (ClampMin = "0.1"))
+	float SampleInterval = 1.f;
+
+	// Whether sessions write the telemetry file and summary
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Telemetry")
+	bool bWriteTelemetryFile = true;
+
+	// Whether sessions also run a CSV profiler capture; forced on by -SkaterCsvCapture
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Telemetry")
+	bool bCaptureCsvProfile = false;
+
+private:
+	// Counters of the frame being recorded
+	FSkaterTelemetryFrame CurrentFrame;
+
+	// Telemetry file writer, open while a session runs
+	TUniquePtr<FArchive> SinkWriter;
+
+	FString SessionName;
+
+	FString SummaryPath;
+
+	// Session statistics ----------------------------------------------
+	double SessionStartTime = 0.0;
+
+	double SessionFrameTime = 0.0;
+
+	float SessionMaxFrameTime = 0.f;
+
+	int64 SessionFrames = 0;
+
+	int64 SessionSkaterFrames = 0;
+
+	int64 SessionCollections = 0;
+
+	int64 SessionPointsBroadcasts = 0;
+
+	int32 PeakSkaters = 0;
+
+	int32 PeakArtifacts = 0;
+
+	int32 PeakFeedbackLive = 0;
+
+	// Row statistics accumulated since the last flush ----------------
+	float SampleAccumulator = 0.f;
+
+	double SampleFrameTime = 0.0;
+
+	int64 SampleSkaters = 0;
+
+	int64 SampleArtifacts = 0;
+
+	int64 SampleFeedbackLive = 0;
+
+	int32 SampleCollections = 0;
+
+	int32 SamplePointsBroadcasts = 0;
+
+	int32 SampleFrames = 0;
+
+	FDelegateHandle CollectedHandle;
+
+	bool bHasBegunPlay = false;
+
+	bool bSessionActive = false;
+
+	bool bOwnsCsvCapture = false;
+};
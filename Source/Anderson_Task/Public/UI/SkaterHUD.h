@@ -5,12 +5,18 @@
 #include "SkaterHUD.generated.h"
 
 class UTextBlock;
+class URetainerBox;
 class ASkaterPlayerState;
 class ASkaterCharacterBase;
+class AGameStateBase;
+class ASkaterGameState;
 
 /**
  * @brief Main HUD widget for displaying game information.
- * @details Displays player points and speed. Binds to PlayerState for point updates.
+ * @details Displays player points, speed and, if RankText is bound, leaderboard rank. Binds to
+ * PlayerState for point updates and to the game state for rank updates.
+ * Speed is quantised and texts are only pushed to Slate when the displayed value changes, so
+ * frames without a visible change cause no layout invalidation.
  */
 UCLASS()
 class ANDERSON_TASK_API USkaterHUD : public UUserWidget
@@ -23,14 +29,17 @@ public:
 	 * @param NewPoints - The new point value to display.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "HUD")
-	void UpdatePoints(int32 NewPoints) const;
+	void UpdatePoints(int32 NewPoints);
 
 	/**
 	 * @brief Updates the displayed speed value.
+	 * @details The speed is quantised to SpeedStep; the text is only updated when the
+	 * quantised value changes.
+	 * 
 	 * @param SpeedPercent - The speed as a percentage (0-1).
 	 */
 	UFUNCTION(BlueprintCallable, Category = "HUD")
-	void UpdateSpeed(float SpeedPercent) const;
+	void UpdateSpeed(float SpeedPercent);
 
 protected:
 	/**
@@ -58,20 +67,81 @@ private:
 	UFUNCTION()
 	void OnPointsChangedHandler(int32 OldPoints, int32 NewPoints, int32 Delta);
 
+	/**
+	 * @brief Subscribes to leaderboard changes from the game state.
+	 * @details On clients the game state can replicate after the HUD is constructed; the bind is
+	 * then retried when the world's game state is set.
+	 */
+	void BindToLeaderboard();
+
+	/**
+	 * @brief Retries the leaderboard bind once the game state arrived.
+	 */
+	void HandleGameStateSet(AGameStateBase* GameState);
+
+	/**
+	 * @brief Updates the displayed rank from the leaderboard.
+	 */
+	void UpdateRank();
+
+	/**
+	 * @brief Pre-builds the speed text for every displayable percentage.
+	 */
+	void BuildSpeedTextCache();
+
+	/**
+	 * @brief Asks the retainer box, if any, to redraw its cached contents.
+	 */
+	void RequestRetainerRender() const;
+
 protected:
 	TWeakObjectPtr<ASkaterPlayerState> CachedPlayerState = nullptr;
 
 	TWeakObjectPtr<ASkaterCharacterBase> CachedPlayerCharacter = nullptr;
 
+	TWeakObjectPtr<ASkaterGameState> CachedGameState = nullptr;
+
 	UPROPERTY(BlueprintReadWrite, Category = "HUD", meta = (BindWidget))
 	UTextBlock* PointsText;
 
 	UPROPERTY(BlueprintReadWrite, Category = "HUD", meta = (BindWidget))
 	UTextBlock* SpeedText;
+
+	// Optional retainer caching the HUD; redrawn only when a displayed value changes
+	UPROPERTY(BlueprintReadWrite, Category = "HUD", meta = (BindWidgetOptional))
+	URetainerBox* HUDRetainer;
+
+	// Optional leaderboard rank
+	UPROPERTY(BlueprintReadWrite, Category = "HUD", meta = (BindWidgetOptional))
+	UTextBlock* RankText;
 	
 	UPROPERTY(EditDefaultsOnly, Category = "HUD|Format")
 	FText PointsFormat = FText::FromString("Points: {0}");
 
 	UPROPERTY(EditDefaultsOnly, Category = "HUD|Format")
 	FText SpeedFormat = FText::FromString("Speed: {0}%");
+
+	// {0} is the rank, {1} the number of ranked players
+	UPROPERTY(EditDefaultsOnly, Category = "HUD|Format")
+	FText RankFormat = FText::FromString("Rank: {0}/{1}");
+
+	// Granularity of the displayed speed percentage
+	UPROPERTY(EditDefaultsOnly, Category = "HUD|Format", meta = (ClampMin = "1", ClampMax = "100"))
+	int32 SpeedStep = 1;
+
+private:
+	// Formatted speed text per quantised percentage, index = percent / SpeedStep
+	TArray<FText> SpeedTextCache;
+
+	// Values currently shown, INDEX_NONE before the first update
+	int32 DisplayedSpeed = INDEX_NONE;
+
+	int32 DisplayedPoints = INDEX_NONE;
+
+	int32 DisplayedRank = INDEX_NONE;
+
+	int32 DisplayedNumRanked = INDEX_NONE;
+
+	// Pending GameStateSetEvent binding while waiting for the game state
+	FDelegateHandle GameStateSetHandle;
 };
@@ -9,5 +9,6 @@ public class Anderson_TaskEditorTarget : TargetRules
 		DefaultBuildSettings = BuildSettingsVersion.V5;
 		IncludeOrderVersion = EngineIncludeOrderVersion.Unreal5_5;
 		ExtraModuleNames.Add("Anderson_Task");
+		ExtraModuleNames.Add("Anderson_TaskTests");
 	}
 }
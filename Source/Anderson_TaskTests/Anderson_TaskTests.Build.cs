@@ -0,0 +1,19 @@
+using UnrealBuildTool;
+
+public class Anderson_TaskTests : ModuleRules
+{
+	public Anderson_TaskTests(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(new string[]
+		{
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"AIModule",
+			"Json",
+			"Anderson_Task"
+		});
+	}
+}
@@ -0,0 +1,4 @@
+#include "Anderson_TaskTests.h"
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, Anderson_TaskTests);
@@ -0,0 +1,566 @@
+#include "Commandlets/SkaterBenchmarkCommandlet.h"
+
+#include "AIController.h"
+#include "Characters/SkaterPlayerCharacter.h"
+#include "Collectables/Artifacts/PointArtifact.h"
+#include "Collectables/DataAssets/ArtifactData.h"
+#include "Components/SkaterMovementComponent.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/WorldSettings.h"
+#include "Interfaces/Collectable.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+#include "PlayerStates/SkaterPlayerState.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Subsystems/ArtifactPoolSubsystem.h"
+#include "Subsystems/PointSystemCacheSubsystem.h"
+#include "Subsystems/SkaterMovementBatchSubsystem.h"
+
+#include <atomic>
+
+DEFINE_LOG_CATEGORY(LogSkaterBenchmark);
+
+namespace SkaterBenchmark
+{
+	/**
+	 * Forwards to the real allocator and counts game-thread allocations while enabled.
+	 * Only forwards, so a block allocated through either allocator can be freed through the other.
+	 */
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		explicit FCountingMalloc(FMalloc* InInner)
+			: Inner(InInner)
+		{
+		}
+
+		void Start()
+		{
+			NumAllocations = 0;
+			NumBytes = 0;
+			bEnabled = true;
+		}
+
+		void Stop()
+		{
+			bEnabled = false;
+		}
+
+		uint64 GetNumAllocations() const { return NumAllocations; }
+		uint64 GetNumBytes() const { return NumBytes; }
+
+		// FMalloc interface
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			Record(Count);
+			return Inner->Malloc(Count, Alignment);
+		}
+
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+		{
+			Record(Count);
+			return Inner->TryMalloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			Record(Count);
+			return Inner->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			Record(Count);
+			return Inner->TryRealloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override { Inner->Free(Original); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual void InitializeStatsMetadata() override { Inner->InitializeStatsMetadata(); }
+		virtual void UpdateStats() override { Inner->UpdateStats(); }
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+		virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+	private:
+		void Record(SIZE_T Count)
+		{
+			// Only the benchmarked code runs on the game thread; worker noise is ignored
+			if (bEnabled && Count > 0 && IsInGameThread())
+			{
+				++NumAllocations;
+				NumBytes += Count;
+			}
+		}
+
+		FMalloc* Inner;
+
+		std::atomic<bool> bEnabled = false;
+
+		uint64 NumAllocations = 0;
+
+		uint64 NumBytes = 0;
+	};
+
+	struct FResult
+	{
+		FString Name;
+
+		int32 Scale = 0;
+
+		double NsPerOp = 0.0;
+
+		double AllocsPerOp = 0.0;
+
+		double BytesPerOp = 0.0;
+
+		FString GetKey() const { return FString::Printf(TEXT("%s@%d"), *Name, Scale); }
+	};
+
+	// Best-of runs for benchmarks that can be repeated on the same state
+	constexpr int32 NumRepeats = 3;
+
+	// Broadcasts per fan-out measurement
+	constexpr int32 NumBroadcasts = 10;
+
+	// Skaters are full characters; larger scales only measure spawning
+	constexpr int32 MaxMovementScale = 10000;
+
+	// Frames simulated per movement measurement
+	constexpr int32 NumMovementFrames = 10;
+
+	/**
+	 * Gets the counting allocator wrapping the real GMalloc.
+	 * Static storage rather than heap: a thread that loaded GMalloc just before the benchmark
+	 * restored it can still finish its call, and nothing is leaked.
+	 */
+	FCountingMalloc& GetCounter()
+	{
+		static FCountingMalloc Counter(GMalloc);
+		return Counter;
+	}
+
+	/**
+	 * Runs Func Repeats times and records the fastest run.
+	 * NumOps is the number of operations performed by one run of Func.
+	 */
+	template <typename FuncType>
+	FResult Measure(const TCHAR* Name, int32 Scale, int32 NumOps, int32 Repeats, FuncType&& Func)
+	{
+		FResult Result;
+		Result.Name = Name;
+		Result.Scale = Scale;
+		Result.NsPerOp = TNumericLimits<double>::Max();
+
+		const double Ops = FMath::Max(NumOps, 1);
+		FCountingMalloc& Counter = GetCounter();
+
+		for (int32 Run = 0; Run < Repeats; ++Run)
+		{
+			Counter.Start();
+			const double StartTime = FPlatformTime::Seconds();
+
+			Func();
+
+			const double Elapsed = FPlatformTime::Seconds() - StartTime;
+			Counter.Stop();
+
+			Result.NsPerOp = FMath::Min(Result.NsPerOp, Elapsed * 1.0e9 / Ops);
+			Result.AllocsPerOp = Counter.GetNumAllocations() / Ops;
+			Result.BytesPerOp = Counter.GetNumBytes() / Ops;
+		}
+
+		UE_LOG(LogSkaterBenchmark, Display, TEXT("%-28s %8d  %12.1f ns/op  %8.3f allocs/op  %10.1f B/op"),
+			*Result.Name, Scale, Result.NsPerOp, Result.AllocsPerOp, Result.BytesPerOp);
+
+		return Result;
+	}
+
+	/**
+	 * Creates a game world that has begun play without a game mode or net driver.
+	 */
+	UWorld* CreateWorld()
+	{
+		UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("SkaterBenchmarkWorld"));
+
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		World->InitializeActorsForPlay(FURL());
+		World->GetWorldSettings()->NotifyBeginPlay();
+
+		return World;
+	}
+
+	void DestroyWorld(UWorld* World)
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	/**
+	 * Benchmarks point lookup, scoring, OnPointsChanged fan-out and artifact collection with
+	 * Scale artifacts and listeners.
+	 */
+	void RunCollectionBenchmarks(int32 Scale, TArray<FResult>& OutResults)
+	{
+		UWorld* World = CreateWorld();
+
+		UArtifactData* Data = NewObject<UArtifactData>(GetTransientPackage());
+		Data->PointValue = 1;
+		Data->AddToRoot();
+
+		ASkaterPlayerState* PlayerState = World->SpawnActor<ASkaterPlayerState>();
+		APawn* Collector = World->SpawnActor<APawn>();
+		Collector->SetPlayerState(PlayerState);
+
+		UArtifactPoolSubsystem* Pool = World->GetSubsystem<UArtifactPoolSubsystem>();
+		const int32 GridSize = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Scale)));
+
+		TArray<APointArtifact*> Artifacts;
+		Artifacts.Reserve(Scale);
+		for (int32 i = 0; i < Scale; ++i)
+		{
+			const FVector Location((i % GridSize) * 200.f, (i / GridSize) * 200.f, 0.f);
+			if (APointArtifact* Artifact = Pool->AcquireArtifact(APointArtifact::StaticClass(), Data,
+				FTransform(Location)))
+			{
+				Artifacts.Add(Artifact);
+			}
+		}
+
+		// Worst case lookup: the pawn forwards to its player state
+		volatile int32 Found = 0;
+		OutResults.Add(Measure(TEXT("FindPointSystemInActor"), Scale, Scale, NumRepeats, [&]()
+		{
+			for (int32 i = 0; i < Scale; ++i)
+			{
+				Found = Found + (APointArtifact::FindPointSystemInActor(Collector) ? 1 : 0);
+			}
+		}));
+
+		UPointSystemCacheSubsystem* PointSystemCache = World->GetSubsystem<UPointSystemCacheSubsystem>();
+		OutResults.Add(Measure(TEXT("ResolvePointSystemCached"), Scale, Scale, NumRepeats, [&]()
+		{
+			for (int32 i = 0; i < Scale; ++i)
+			{
+				Found = Found + (PointSystemCache->Resolve(Collector).IsValid() ? 1 : 0);
+			}
+		}));
+
+		OutResults.Add(Measure(TEXT("AddPoints"), Scale, Scale, NumRepeats, [&]()
+		{
+			for (int32 i = 0; i < Scale; ++i)
+			{
+				PlayerState->AddPoints_Implementation(1);
+			}
+		}));
+
+		TArray<USkaterBenchmarkPointsListener*> Listeners;
+		Listeners.Reserve(Scale);
+		for (int32 i = 0; i < Scale; ++i)
+		{
+			USkaterBenchmarkPointsListener* Listener = NewObject<USkaterBenchmarkPointsListener>(World);
+			Listeners.Add(Listener);
+
+			FScriptDelegate Delegate;
+			Delegate.BindUFunction(Listener,
+				GET_FUNCTION_NAME_CHECKED(USkaterBenchmarkPointsListener, HandlePointsChanged));
+			PlayerState->OnPointsChanged.Add(Delegate);
+		}
+
+		OutResults.Add(Measure(TEXT("OnPointsChangedFanOut"), Scale, NumBroadcasts, NumRepeats, [&]()
+		{
+			for (int32 i = 0; i < NumBroadcasts; ++i)
+			{
+				PlayerState->OnPointsChanged.Broadcast(0, 1, 1);
+			}
+		}));
+
+		PlayerState->OnPointsChanged.Clear();
+
+		// Collection consumes the artifacts, so this one runs once
+		OutResults.Add(Measure(TEXT("OnCollected"), Scale, Artifacts.Num(), 1, [&]()
+		{
+			for (APointArtifact* Artifact : Artifacts)
+			{
+				ICollectable::Execute_OnCollected(Artifact, Collector);
+			}
+		}));
+
+		Data->RemoveFromRoot();
+		DestroyWorld(World);
+	}
+
+	/**
+	 * Benchmarks the steering update of Scale possessed skaters through their own tick and
+	 * through the movement batch.
+	 */
+	void RunMovementBenchmarks(int32 Scale, TArray<FResult>& OutResults)
+	{
+		if (Scale > MaxMovementScale)
+		{
+			UE_LOG(LogSkaterBenchmark, Display, TEXT("Skipping movement benchmarks at scale %d"), Scale);
+			return;
+		}
+
+		UWorld* World = CreateWorld();
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		const int32 GridSize = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Scale)));
+
+		TArray<ASkaterCharacterBase*> Skaters;
+		TArray<USkaterMovementComponent*> Movements;
+		TArray<FVector2D> SkaterInputs;
+		Skaters.Reserve(Scale);
+		Movements.Reserve(Scale);
+		SkaterInputs.Reserve(Scale);
+
+		for (int32 i = 0; i < Scale; ++i)
+		{
+			const FVector Location((i % GridSize) * 300.f, (i / GridSize) * 300.f, 100.f);
+			ASkaterCharacterBase* Skater = World->SpawnActor<ASkaterPlayerCharacter>(Location, FRotator::ZeroRotator,
+				SpawnParams);
+			USkaterMovementComponent* Movement = Skater
+				? Cast<USkaterMovementComponent>(Skater->GetCharacterMovement()) : nullptr;
+			if (!Movement)
+			{
+				continue;
+			}
+
+			// Locally controlled, like an AI crowd on the server
+			AAIController* Controller = World->SpawnActor<AAIController>(SpawnParams);
+			if (!Controller)
+			{
+				UE_LOG(LogSkaterBenchmark, Error, TEXT("Failed to spawn a controller, skipping movement benchmarks at scale %d"),
+					Scale);
+				DestroyWorld(World);
+				return;
+			}
+
+			Controller->Possess(Skater);
+
+			Skaters.Add(Skater);
+			Movements.Add(Movement);
+
+			// Mix of left, straight and right while accelerating
+			SkaterInputs.Emplace(static_cast<float>(i % 3 - 1), 1.f);
+		}
+
+		const float DeltaTime = 1.f / 60.f;
+		const int32 NumOps = Skaters.Num() * NumMovementFrames;
+
+		OutResults.Add(Measure(TEXT("SkaterTickSteering"), Scale, NumOps, NumRepeats, [&]()
+		{
+			for (int32 Frame = 0; Frame < NumMovementFrames; ++Frame)
+			{
+				for (int32 i = 0; i < Skaters.Num(); ++i)
+				{
+					Skaters[i]->SetMovementInput(SkaterInputs[i]);
+					Skaters[i]->Tick(DeltaTime);
+					Movements[i]->ApplySteering(DeltaTime);
+				}
+			}
+		}));
+
+		USkaterMovementBatchSubsystem* Batch = World->GetSubsystem<USkaterMovementBatchSubsystem>();
+		for (ASkaterCharacterBase* Skater : Skaters)
+		{
+			Skater->SetUseBatchedMovement(true);
+		}
+
+		OutResults.Add(Measure(TEXT("SkaterBatchedSteering"), Scale, NumOps, NumRepeats, [&]()
+		{
+			for (int32 Frame = 0; Frame < NumMovementFrames; ++Frame)
+			{
+				for (int32 i = 0; i < Skaters.Num(); ++i)
+				{
+					Skaters[i]->SetMovementInput(SkaterInputs[i]);
+				}
+
+				Batch->UpdateSkaters(DeltaTime);
+			}
+		}));
+
+		DestroyWorld(World);
+	}
+
+	TSharedRef<FJsonObject> ResultsToJson(const TArray<FResult>& Results)
+	{
+		TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+		for (const FResult& Result : Results)
+		{
+			TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+			Entry->SetNumberField(TEXT("NsPerOp"), Result.NsPerOp);
+			Entry->SetNumberField(TEXT("AllocsPerOp"), Result.AllocsPerOp);
+			Entry->SetNumberField(TEXT("BytesPerOp"), Result.BytesPerOp);
+			Root->SetObjectField(Result.GetKey(), Entry);
+		}
+
+		return Root;
+	}
+
+	bool SaveJson(const TSharedRef<FJsonObject>& Json, const FString& Path)
+	{
+		FString Output;
+		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+		return FJsonSerializer::Serialize(Json, Writer) && FFileHelper::SaveStringToFile(Output, *Path);
+	}
+}
+
+void USkaterBenchmarkPointsListener::HandlePointsChanged(int32 OldPoints, int32 NewPoints, int32 Delta)
+{
+	ReceivedDelta += Delta;
+}
+
+USkaterBenchmarkCommandlet::USkaterBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = true;
+	LogToConsole = true;
+}
+
+int32 USkaterBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace SkaterBenchmark;
+
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamValues;
+	ParseCommandLine(*Params, Tokens, Switches, ParamValues);
+
+	TArray<int32> Scales = { 1000, 10000, 100000 };
+	if (const FString* ScalesParam = ParamValues.Find(TEXT("Scales")))
+	{
+		TArray<FString> ScaleStrings;
+		ScalesParam->ParseIntoArray(ScaleStrings, TEXT(","));
+
+		Scales.Reset();
+		for (const FString& ScaleString : ScaleStrings)
+		{
+			const int32 Scale = FCString::Atoi(*ScaleString);
+			if (Scale > 0)
+			{
+				Scales.Add(Scale);
+			}
+		}
+	}
+
+	const FString* BaselineParam = ParamValues.Find(TEXT("Baseline"));
+	const FString BaselinePath = BaselineParam ? *BaselineParam
+		: FPaths::ProjectDir() / TEXT("Benchmarks/SkaterBenchmarkBaseline.json");
+
+	const FString* TimeToleranceParam = ParamValues.Find(TEXT("TimeTolerance"));
+	const double TimeTolerance = TimeToleranceParam ? FCString::Atod(**TimeToleranceParam) : 0.25;
+
+	const FString* AllocToleranceParam = ParamValues.Find(TEXT("AllocTolerance"));
+	const double AllocTolerance = AllocToleranceParam ? FCString::Atod(**AllocToleranceParam) : 0.1;
+
+	TArray<FResult> Results;
+	{
+		// Counts only while the benchmarks run; the real allocator is back before reporting
+		FMalloc* const PreviousMalloc = GMalloc;
+		GMalloc = &GetCounter();
+		FPlatformMisc::MemoryBarrier();
+
+		ON_SCOPE_EXIT
+		{
+			GMalloc = PreviousMalloc;
+			FPlatformMisc::MemoryBarrier();
+		};
+
+		for (const int32 Scale : Scales)
+		{
+			RunCollectionBenchmarks(Scale, Results);
+			RunMovementBenchmarks(Scale, Results);
+		}
+	}
+
+	const TSharedRef<FJsonObject> ResultsJson = ResultsToJson(Results);
+
+	const FString ReportPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks") /
+		FString::Printf(TEXT("SkaterBenchmark_%s.json"), *FDateTime::Now().ToString());
+	if (SaveJson(ResultsJson, ReportPath))
+	{
+		UE_LOG(LogSkaterBenchmark, Display, TEXT("Results written to %s"), *ReportPath);
+	}
+
+	if (Switches.Contains(TEXT("UpdateBaseline")))
+	{
+		if (!SaveJson(ResultsJson, BaselinePath))
+		{
+			UE_LOG(LogSkaterBenchmark, Error, TEXT("Failed to write baseline %s"), *BaselinePath);
+			return 1;
+		}
+
+		UE_LOG(LogSkaterBenchmark, Display, TEXT("Baseline updated: %s"), *BaselinePath);
+		return 0;
+	}
+
+	FString BaselineString;
+	TSharedPtr<FJsonObject> Baseline;
+	if (!FFileHelper::LoadFileToString(BaselineString, *BaselinePath) ||
+		!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(BaselineString), Baseline) || !Baseline)
+	{
+		UE_LOG(LogSkaterBenchmark, Error, TEXT("No baseline at %s, run with -UpdateBaseline to create one"),
+			*BaselinePath);
+		return 1;
+	}
+
+	int32 NumRegressions = 0;
+	for (const FResult& Result : Results)
+	{
+		const TSharedPtr<FJsonObject>* Entry = nullptr;
+		if (!Baseline->TryGetObjectField(Result.GetKey(), Entry))
+		{
+			UE_LOG(LogSkaterBenchmark, Warning, TEXT("%s has no baseline entry, run with -UpdateBaseline to add it"),
+				*Result.GetKey());
+			continue;
+		}
+
+		const double BaselineNs = (*Entry)->GetNumberField(TEXT("NsPerOp"));
+		const double BaselineAllocs = (*Entry)->GetNumberField(TEXT("AllocsPerOp"));
+
+		if (Result.NsPerOp > BaselineNs * (1.0 + TimeTolerance))
+		{
+			UE_LOG(LogSkaterBenchmark, Error, TEXT("%s regressed: %.1f ns/op (baseline %.1f)"), *Result.GetKey(),
+				Result.NsPerOp, BaselineNs);
+			++NumRegressions;
+		}
+
+		// Allocation counts are deterministic; the epsilon absorbs one-off container growth
+		if (Result.AllocsPerOp > BaselineAllocs * (1.0 + AllocTolerance) + 0.01)
+		{
+			UE_LOG(LogSkaterBenchmark, Error, TEXT("%s regressed: %.3f allocs/op (baseline %.3f)"),
+				*Result.GetKey(), Result.AllocsPerOp, BaselineAllocs);
+			++NumRegressions;
+		}
+	}
+
+	if (NumRegressions > 0)
+	{
+		UE_LOG(LogSkaterBenchmark, Error, TEXT("%d benchmark regression(s) against %s"), NumRegressions,
+			*BaselinePath);
+		return 1;
+	}
+
+	UE_LOG(LogSkaterBenchmark, Display, TEXT("All benchmarks within tolerance of %s"), *BaselinePath);
+	return 0;
+}
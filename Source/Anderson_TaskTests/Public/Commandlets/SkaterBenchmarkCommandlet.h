@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "SkaterBenchmarkCommandlet.generated.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSkaterBenchmark, Log, All);
+
+/**
+ * @brief Commandlet benchmarking the collection, scoring and movement hot paths in a headless world.
+ * @details Runs every benchmark at each scale (1k, 10k and 100k by default), reporting time and
+ * game-thread allocations per operation. Results are compared against a stored JSON baseline and
+ * the commandlet returns non-zero when any benchmark regresses past the tolerance or the baseline
+ * is missing. Lives in the editor-only tests module, so the allocation counter never ships.
+ *
+ * Usage: UnrealEditor-Cmd Anderson_Task.uproject -run=SkaterBenchmark [options]
+ *  -Scales=1000,10000      Scales to run.
+ *  -Baseline=Path          Baseline file, defaults to Benchmarks/SkaterBenchmarkBaseline.json. Not
+ *                          checked in; create it with -UpdateBaseline on the reference machine.
+ *  -UpdateBaseline         Writes the results as the new baseline instead of comparing.
+ *  -TimeTolerance=0.25     Allowed relative slowdown per operation.
+ *  -AllocTolerance=0.1     Allowed relative increase in allocations per operation.
+ */
+UCLASS()
+class ANDERSON_TASKTESTS_API USkaterBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	USkaterBenchmarkCommandlet();
+
+	// UCommandlet interface
+	virtual int32 Main(const FString& Params) override;
+};
+
+/**
+ * @brief Receiver bound to OnPointsChanged to measure broadcast fan-out.
+ */
+UCLASS(Transient)
+class USkaterBenchmarkPointsListener : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION()
+	void HandlePointsChanged(int32 OldPoints, int32 NewPoints, int32 Delta);
+
+	// Sum of received deltas, keeps the handler from being optimized away
+	int64 ReceivedDelta = 0;
+};